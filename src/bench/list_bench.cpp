@@ -0,0 +1,788 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <ranges>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "compact_list.hpp"
+#include "concurrent_list.hpp"
+#include "cow_list.hpp"
+#include "indexed_list.hpp"
+#include "list.hpp"
+#include "rcu_list.hpp"
+#include "small_list.hpp"
+#include "unrolled_list.hpp"
+
+/*
+ * Набор микробенчмарков List в сравнении с контейнерами стандартной библиотеки.
+ *
+ * Имена бенчмарков: <операция>/<контейнер>/<тип элемента>/<размер>.
+ * Результаты в машиночитаемом виде:
+ *      ./list_bench --benchmark_format=json
+ *      ./list_bench --benchmark_out=result.csv --benchmark_out_format=csv
+ * Размеры перебираются от 1e2 до 1e7, верхнюю границу можно уменьшить
+ * флагом --max-size=N. Выбор отдельных бенчмарков - --benchmark_filter=<regex>.
+ */
+
+/// @brief POD размером 64 байта; сравнивается по ключу
+struct Pod64 {
+    uint32_t key = 0;
+    uint32_t payload[15] = {};
+
+    bool operator<(const Pod64& other) const { return key < other.key; }
+    bool operator==(const Pod64& other) const { return key == other.key; }
+};
+static_assert(sizeof(Pod64) == 64);
+
+template <typename T>
+T makeValue(uint32_t seed);
+
+template <>
+int makeValue<int>(uint32_t seed) {
+    return static_cast<int>(seed);
+}
+
+template <>
+Pod64 makeValue<Pod64>(uint32_t seed) {
+    Pod64 value;
+    value.key = seed;
+    value.payload[0] = seed ^ 0x5bd1e995u;
+    return value;
+}
+
+template <>
+std::string makeValue<std::string>(uint32_t seed) {
+    // длиннее буфера SSO, чтобы строка жила в куче
+    std::string value(32, 'a');
+    for (size_t i = 0; i < 8; ++i) {
+        value[i] = static_cast<char>('a' + (seed >> (i * 4)) % 16);
+    }
+    return value;
+}
+
+/// @brief Ключ элемента для суммирования при обходе
+inline uint64_t keyOf(int value) { return static_cast<uint32_t>(value); }
+inline uint64_t keyOf(const Pod64& value) { return value.key; }
+inline uint64_t keyOf(const std::string& value) { return static_cast<unsigned char>(value[0]); }
+
+template <typename T>
+const char* typeName();
+template <> const char* typeName<int>() { return "int"; }
+template <> const char* typeName<Pod64>() { return "pod64"; }
+template <> const char* typeName<std::string>() { return "string"; }
+
+/// @brief Детерминированный набор значений для заполнения контейнеров
+template <typename T>
+const std::vector<T>& values(size_t count) {
+    static std::vector<T> cache;
+    if (cache.size() < count) {
+        cache.clear();
+        cache.reserve(count);
+        uint32_t seed = 2463534242u;
+        for (size_t i = 0; i < count; ++i) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            cache.push_back(makeValue<T>(seed));
+        }
+    }
+    return cache;
+}
+
+template <typename C>
+C makeContainer(size_t count) {
+    const auto& source = values<typename C::value_type>(count);
+    C container;
+    for (size_t i = 0; i < count; ++i) {
+        container.push_back(source[i]);
+    }
+    return container;
+}
+
+template <typename C, typename = void>
+struct HasMemberSort : std::false_type {};
+
+template <typename C>
+struct HasMemberSort<C, std::void_t<decltype(std::declval<C&>().sort())>> : std::true_type {};
+
+template <typename C>
+void sortContainer(C& container) {
+    if constexpr (HasMemberSort<C>::value) {
+        container.sort();
+    }
+    else {
+        std::sort(container.begin(), container.end());
+    }
+}
+
+template <typename C, typename = void>
+struct HasMemberAt : std::false_type {};
+
+template <typename C>
+struct HasMemberAt<C, std::void_t<decltype(std::declval<C&>().at(size_t()))>> : std::true_type {};
+
+/// @brief Элемент с номером ```index```: через ```at```, если он есть, иначе обходом
+template <typename C>
+const typename C::value_type& elementAt(const C& container, size_t index) {
+    if constexpr (HasMemberAt<C>::value) {
+        return container.at(index);
+    }
+    else {
+        return *std::next(container.begin(), index);
+    }
+}
+
+template <typename C>
+void reverseContainer(C& container) {
+    if constexpr (HasMemberSort<C>::value) {
+        container.reverse();
+    }
+    else {
+        std::reverse(container.begin(), container.end());
+    }
+}
+
+template <typename C>
+void BM_PushBack(benchmark::State& state) {
+    size_t count = state.range(0);
+    const auto& source = values<typename C::value_type>(count);
+    for (auto _ : state) {
+        C container;
+        for (size_t i = 0; i < count; ++i) {
+            container.push_back(source[i]);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename C>
+void BM_PushFront(benchmark::State& state) {
+    size_t count = state.range(0);
+    const auto& source = values<typename C::value_type>(count);
+    for (auto _ : state) {
+        C container;
+        for (size_t i = 0; i < count; ++i) {
+            container.push_front(source[i]);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Вставка count/10 элементов перед серединой контейнера
+template <typename C>
+void BM_InsertMiddle(benchmark::State& state) {
+    size_t count = state.range(0);
+    size_t inserts = std::max<size_t>(1, count / 10);
+    const auto& source = values<typename C::value_type>(count);
+    for (auto _ : state) {
+        state.PauseTiming();
+        C container = makeContainer<C>(count);
+        state.ResumeTiming();
+        for (size_t i = 0; i < inserts; ++i) {
+            auto pos = std::next(container.begin(), container.size() / 2);
+            container.insert(pos, source[i]);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * inserts);
+}
+
+/// @brief Вставка count/10 элементов перед заранее найденной позицией в середине
+template <typename C>
+void BM_InsertAtIterator(benchmark::State& state) {
+    size_t count = state.range(0);
+    size_t inserts = std::max<size_t>(1, count / 10);
+    const auto& source = values<typename C::value_type>(count);
+    for (auto _ : state) {
+        state.PauseTiming();
+        C container = makeContainer<C>(count);
+        auto pos = std::next(container.begin(), count / 2);
+        state.ResumeTiming();
+        for (size_t i = 0; i < inserts; ++i) {
+            pos = container.insert(pos, source[i]);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * inserts);
+}
+
+/// @brief Удаление каждого второго элемента по итератору
+template <typename C>
+void BM_EraseEveryOther(benchmark::State& state) {
+    size_t count = state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        C container = makeContainer<C>(count);
+        state.ResumeTiming();
+        auto it = container.begin();
+        while (it != container.end()) {
+            it = container.erase(it);
+            if (it != container.end()) {
+                ++it;
+            }
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * (count / 2));
+}
+
+template <typename C>
+void BM_Sort(benchmark::State& state) {
+    size_t count = state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        C container = makeContainer<C>(count);
+        state.ResumeTiming();
+        sortContainer(container);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Сортировка по ключу ```keyOf```: ```sort_by_key``` (поразрядная) или ```sort``` с компаратором
+template <typename C, bool ByKey>
+void BM_SortByKey(benchmark::State& state) {
+    size_t count = state.range(0);
+    using Value = typename C::value_type;
+    for (auto _ : state) {
+        state.PauseTiming();
+        C container = makeContainer<C>(count);
+        state.ResumeTiming();
+        if constexpr (ByKey) {
+            container.sort_by_key([](const Value& value) { return keyOf(value); });
+        }
+        else {
+            container.sort([](const Value& left, const Value& right) { return keyOf(left) < keyOf(right); });
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Сортировка ```List``` во всех аппаратных потоках
+template <typename C>
+void BM_SortParallel(benchmark::State& state) {
+    size_t count = state.range(0);
+    for (auto _ : state) {
+        state.PauseTiming();
+        C container = makeContainer<C>(count);
+        state.ResumeTiming();
+        container.sort(listPar);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Чтение count/10 элементов по псевдослучайным номерам
+template <typename C>
+void BM_SeekIndex(benchmark::State& state) {
+    size_t count = state.range(0);
+    size_t seeks = std::max<size_t>(1, count / 10);
+    C container = makeContainer<C>(count);
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        uint32_t seed = 2463534242u;
+        for (size_t i = 0; i < seeks; ++i) {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            sum += keyOf(elementAt(container, seed % count));
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * seeks);
+}
+
+template <typename C>
+void BM_Reverse(benchmark::State& state) {
+    size_t count = state.range(0);
+    C container = makeContainer<C>(count);
+    for (auto _ : state) {
+        reverseContainer(container);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename C>
+void BM_Copy(benchmark::State& state) {
+    size_t count = state.range(0);
+    C container = makeContainer<C>(count);
+    for (auto _ : state) {
+        C copy(container);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template <typename C>
+void BM_Iterate(benchmark::State& state) {
+    size_t count = state.range(0);
+    C container = makeContainer<C>(count);
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& value : container) {
+            sum += keyOf(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Обход после сортировки: узлы идут вразброс по памяти; с ```Compact``` - после ```compact()```
+template <typename C, bool Compact>
+void BM_IterateSorted(benchmark::State& state) {
+    size_t count = state.range(0);
+    C container = makeContainer<C>(count);
+    container.sort();
+    if constexpr (Compact) {
+        container.compact();
+    }
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const auto& value : container) {
+            sum += keyOf(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Подсчёт элементов с нечётным ключом: членом ```count_if``` или циклом по итераторам
+template <typename C, bool Member>
+void BM_CountIf(benchmark::State& state) {
+    size_t count = state.range(0);
+    C container = makeContainer<C>(count);
+    container.sort();
+    auto odd = [](const typename C::value_type& value) { return (keyOf(value) & 1) != 0; };
+    for (auto _ : state) {
+        size_t hits = 0;
+        if constexpr (Member) {
+            hits = container.count_if(odd);
+        }
+        else {
+            for (auto it = container.begin(); it != container.end(); ++it) {
+                hits += odd(*it) ? 1 : 0;
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Поиск отсутствующего значения: членом ```find``` или циклом по итераторам
+template <typename C, bool Member>
+void BM_FindMissing(benchmark::State& state) {
+    size_t count = state.range(0);
+    C container = makeContainer<C>(count);
+    container.sort();
+    // значения генератора не повторяются, поэтому следующего в последовательности нет в списке
+    auto missing = values<typename C::value_type>(count + 1)[count];
+    for (auto _ : state) {
+        bool found = false;
+        if constexpr (Member) {
+            found = container.find(missing) != container.end();
+        }
+        else {
+            for (auto it = container.begin(); it != container.end(); ++it) {
+                if (*it == missing) {
+                    found = true;
+                    break;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Слияние двух отсортированных списков половинного размера
+template <typename C>
+void BM_MergeSorted(benchmark::State& state) {
+    size_t count = state.range(0);
+    C source = makeContainer<C>(count);
+    source.sort();
+    C left;
+    C right;
+    for (auto _ : state) {
+        state.PauseTiming();
+        left.clear();
+        bool toLeft = true;
+        for (const auto& value : source) {
+            (toLeft ? left : right).push_back(value);
+            toLeft = !toLeft;
+        }
+        state.ResumeTiming();
+        left.merge(right, std::less<typename C::value_type>());
+        benchmark::DoNotOptimize(left);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Разделение по нечётности ключа: ```partition``` или копирование отвергнутых и ```remove_if```
+template <typename C, bool Member>
+void BM_Partition(benchmark::State& state) {
+    size_t count = state.range(0);
+    C source = makeContainer<C>(count);
+    auto odd = [](const typename C::value_type& value) { return (keyOf(value) & 1) != 0; };
+    for (auto _ : state) {
+        state.PauseTiming();
+        C container(source);
+        state.ResumeTiming();
+        if constexpr (Member) {
+            C rejected = container.partition(odd);
+            benchmark::DoNotOptimize(rejected);
+        }
+        else {
+            C rejected;
+            for (const auto& value : container) {
+                if (!odd(value)) {
+                    rejected.push_back(value);
+                }
+            }
+            container.remove_if([&odd](const typename C::value_type& value) { return !odd(value); });
+            benchmark::DoNotOptimize(rejected);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Конвейер "фильтр -> преобразование": через ```std::views``` с одной материализацией
+///     результата или через временный список после каждого шага
+template <typename C, bool Lazy>
+void BM_Pipeline(benchmark::State& state) {
+    size_t count = state.range(0);
+    C source = makeContainer<C>(count);
+    using V = typename C::value_type;
+    auto odd = [](const V& value) { return (keyOf(value) & 1) != 0; };
+    auto widen = [](const V& value) { return static_cast<uint64_t>(keyOf(value)) * 3; };
+    for (auto _ : state) {
+        if constexpr (Lazy) {
+            List<uint64_t> result(from_range, source | std::views::filter(odd) | std::views::transform(widen));
+            benchmark::DoNotOptimize(result);
+        }
+        else {
+            C filtered;
+            for (const auto& value : source) {
+                if (odd(value)) {
+                    filtered.push_back(value);
+                }
+            }
+            List<uint64_t> result;
+            for (const auto& value : filtered) {
+                result.push_back(widen(value));
+            }
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Материализация диапазона известного размера: ```from_range``` против ```push_back```
+template <typename C, bool Bulk>
+void BM_FromRange(benchmark::State& state) {
+    size_t count = state.range(0);
+    C source = makeContainer<C>(count);
+    auto widen = [](const typename C::value_type& value) { return static_cast<uint64_t>(keyOf(value)) * 3; };
+    for (auto _ : state) {
+        auto view = source | std::views::transform(widen);
+        if constexpr (Bulk) {
+            List<uint64_t> result(from_range, view);
+            benchmark::DoNotOptimize(result);
+        }
+        else {
+            List<uint64_t> result;
+            for (uint64_t value : view) {
+                result.push_back(value);
+            }
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Очередь постоянной длины: на каждом шаге элемент добавляется в конец и снимается с начала
+template <typename C>
+void BM_QueueChurn(benchmark::State& state) {
+    size_t count = state.range(0);
+    const auto& data = values<typename C::value_type>(64);
+    C queue;
+    for (const auto& value : data) {
+        queue.push_back(value);
+    }
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            queue.push_back(data[i % data.size()]);
+            queue.pop_front();
+        }
+        benchmark::DoNotOptimize(queue.front());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Копия, которую читатель слегка меняет: добавляет один элемент в конец
+template <typename C>
+void BM_CopyAndAppend(benchmark::State& state) {
+    size_t count = state.range(0);
+    C container = makeContainer<C>(count);
+    for (auto _ : state) {
+        C copy(container);
+        copy.push_back(container.front());
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Много короткоживущих списков по 4 элемента, как списки на один запрос
+template <typename C>
+void BM_TinyLists(benchmark::State& state) {
+    size_t count = state.range(0);
+    auto data = values<typename C::value_type>(4);
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            C container;
+            for (const auto& value : data) {
+                container.push_back(value);
+            }
+            benchmark::DoNotOptimize(container.back());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief Чтение списка, записанного ```save```, из потока в памяти
+template <typename C>
+void BM_Load(benchmark::State& state) {
+    size_t count = state.range(0);
+    std::stringstream stream;
+    makeContainer<C>(count).save(stream);
+    C container;
+    for (auto _ : state) {
+        stream.clear();
+        stream.seekg(0);
+        container.load(stream);
+        benchmark::DoNotOptimize(container.size());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// @brief ```List``` под одним общим мьютексом - базовая линия для ```ConcurrentList```
+template <typename T>
+class LockedList {
+public:
+    void push_back(const T& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        list.push_back(value);
+    }
+
+    bool try_pop_front(T& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (list.empty()) {
+            return false;
+        }
+        list.pop_front(out);
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    List<T> list;
+};
+
+/// @brief Очередь задач: каждый поток кладёт элемент в конец и забирает из начала
+template <typename Q>
+void BM_QueueContention(benchmark::State& state) {
+    static Q* queue = nullptr;
+    if (state.thread_index() == 0) {
+        queue = new Q();
+    }
+    constexpr int batch = 64;
+    int out = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < batch; ++i) {
+            queue->push_back(i);
+        }
+        for (int i = 0; i < batch; ++i) {
+            queue->try_pop_front(out);
+        }
+    }
+    benchmark::DoNotOptimize(out);
+    state.SetItemsProcessed(state.iterations() * batch * 2);
+    if (state.thread_index() == 0) {
+        delete queue;
+        queue = nullptr;
+    }
+}
+
+/// @brief ```List``` под ```std::shared_mutex``` - базовая линия для ```RcuList```
+template <typename T>
+class SharedLockedList {
+public:
+    void push_back(const T& value) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        list.push_back(value);
+    }
+
+    size_t remove(const T& value) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        return list.remove_if([&value](const T& data) { return data == value; });
+    }
+
+    template <typename F>
+    void for_each(F f) const {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        for (const T& value : list) {
+            f(value);
+        }
+    }
+
+private:
+    mutable std::shared_mutex mutex;
+    List<T> list;
+};
+
+/// @brief Таблица на 64 элемента, которую все потоки обходят, а первый поток изредка меняет
+template <typename L>
+void BM_ReadMostly(benchmark::State& state) {
+    static L* table = nullptr;
+    constexpr int entries = 64;
+    if (state.thread_index() == 0) {
+        table = new L();
+        for (int i = 0; i < entries; ++i) {
+            table->push_back(i);
+        }
+    }
+    uint64_t sum = 0;
+    int next = entries;
+    for (auto _ : state) {
+        if (state.thread_index() == 0 && state.iterations() % 1024 == 0) {
+            table->remove(next - entries);
+            table->push_back(next++);
+        }
+        table->for_each([&sum](int value) { sum += value; });
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * entries);
+    if (state.thread_index() == 0) {
+        delete table;
+        table = nullptr;
+    }
+}
+
+/// @brief Верхняя граница размеров, задаётся флагом --max-size
+static int64_t maxSize = 10'000'000;
+
+/// @brief Граница размеров для операций с квадратичной сложностью
+static constexpr int64_t quadraticLimit = 100'000;
+
+template <typename Fn>
+void registerSized(const std::string& name, Fn fn, int64_t limit) {
+    auto* bench = benchmark::RegisterBenchmark(name.c_str(), fn);
+    for (int64_t size = 100; size <= std::min(limit, maxSize); size *= 10) {
+        bench->Arg(size);
+    }
+    bench->Unit(benchmark::kMicrosecond);
+}
+
+template <typename C>
+void registerContainer(const std::string& container, bool sequenceLike) {
+    std::string suffix = "/" + container + "/" + typeName<typename C::value_type>();
+    int64_t iteratorLimit = sequenceLike ? quadraticLimit : maxSize;
+
+    registerSized("push_back" + suffix, BM_PushBack<C>, maxSize);
+    if constexpr (!std::is_same_v<C, std::vector<typename C::value_type>>) {
+        registerSized("push_front" + suffix, BM_PushFront<C>, maxSize);
+    }
+    // поиск середины списка линеен, поэтому insert_middle квадратичен для всех контейнеров
+    registerSized("insert_middle" + suffix, BM_InsertMiddle<C>, quadraticLimit);
+    registerSized("insert_at_iterator" + suffix, BM_InsertAtIterator<C>, iteratorLimit);
+    registerSized("erase_every_other" + suffix, BM_EraseEveryOther<C>, iteratorLimit);
+    registerSized("sort" + suffix, BM_Sort<C>, maxSize);
+    registerSized("reverse" + suffix, BM_Reverse<C>, maxSize);
+    registerSized("copy" + suffix, BM_Copy<C>, maxSize);
+    registerSized("iterate" + suffix, BM_Iterate<C>, maxSize);
+    // без at поиск k-го элемента линеен, и seek_index становится квадратичным
+    registerSized("seek_index" + suffix, BM_SeekIndex<C>, HasMemberAt<C>::value ? maxSize : quadraticLimit);
+}
+
+template <typename T>
+void registerType() {
+    registerContainer<List<T>>("List", false);
+    registerSized(std::string("sort_par/List/") + typeName<T>(), BM_SortParallel<List<T>>, maxSize);
+    registerSized(std::string("sort_by_key/List/") + typeName<T>(), BM_SortByKey<List<T>, true>, maxSize);
+    registerSized(std::string("sort_by_compare/List/") + typeName<T>(), BM_SortByKey<List<T>, false>, maxSize);
+    registerSized(std::string("iterate_sorted/List/") + typeName<T>(), BM_IterateSorted<List<T>, false>, maxSize);
+    registerSized(std::string("iterate_compacted/List/") + typeName<T>(), BM_IterateSorted<List<T>, true>, maxSize);
+    registerSized(std::string("count_if/List/") + typeName<T>(), BM_CountIf<List<T>, true>, maxSize);
+    registerSized(std::string("count_if_naive/List/") + typeName<T>(), BM_CountIf<List<T>, false>, maxSize);
+    registerSized(std::string("find/List/") + typeName<T>(), BM_FindMissing<List<T>, true>, maxSize);
+    registerSized(std::string("find_naive/List/") + typeName<T>(), BM_FindMissing<List<T>, false>, maxSize);
+    registerSized(std::string("load/List/") + typeName<T>(), BM_Load<List<T>>, maxSize);
+    registerSized(std::string("merge_sorted/List/") + typeName<T>(), BM_MergeSorted<List<T>>, maxSize);
+    registerSized(std::string("merge_sorted/std::list/") + typeName<T>(), BM_MergeSorted<std::list<T>>, maxSize);
+    registerSized(std::string("partition/List/") + typeName<T>(), BM_Partition<List<T>, true>, maxSize);
+    registerSized(std::string("partition_naive/List/") + typeName<T>(), BM_Partition<List<T>, false>, maxSize);
+    registerSized(std::string("pipeline/views/") + typeName<T>(), BM_Pipeline<List<T>, true>, maxSize);
+    registerSized(std::string("pipeline/staged/") + typeName<T>(), BM_Pipeline<List<T>, false>, maxSize);
+    registerSized(std::string("from_range/List/") + typeName<T>(), BM_FromRange<List<T>, true>, maxSize);
+    registerSized(std::string("from_range/push_back/") + typeName<T>(), BM_FromRange<List<T>, false>, maxSize);
+    registerSized(std::string("queue_churn/List/") + typeName<T>(), BM_QueueChurn<List<T>>, maxSize);
+    registerSized(std::string("queue_churn/std::list/") + typeName<T>(), BM_QueueChurn<std::list<T>>, maxSize);
+    registerSized(std::string("queue_churn/std::deque/") + typeName<T>(), BM_QueueChurn<std::deque<T>>, maxSize);
+    registerSized(std::string("tiny_lists/List/") + typeName<T>(), BM_TinyLists<List<T>>, maxSize);
+    registerSized(std::string("tiny_lists/SmallList/") + typeName<T>(), BM_TinyLists<SmallList<T>>, maxSize);
+    registerSized(std::string("copy/CowList/") + typeName<T>(), BM_Copy<CowList<T>>, maxSize);
+    registerSized(std::string("copy_append/List/") + typeName<T>(), BM_CopyAndAppend<List<T>>, maxSize);
+    registerSized(std::string("copy_append/CowList/") + typeName<T>(), BM_CopyAndAppend<CowList<T>>, maxSize);
+    registerContainer<UnrolledList<T>>("UnrolledList", false);
+    registerContainer<CompactList<T>>("CompactList", false);
+    registerContainer<IndexedList<T>>("IndexedList", false);
+    registerContainer<std::list<T>>("std::list", false);
+    registerContainer<std::deque<T>>("std::deque", true);
+    registerContainer<std::vector<T>>("std::vector", true);
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--max-size=", 11) == 0) {
+            maxSize = std::atoll(argv[i] + 11);
+            std::copy(argv + i + 1, argv + argc, argv + i);
+            --argc;
+            --i;
+        }
+    }
+
+    registerType<int>();
+    registerType<Pod64>();
+    registerType<std::string>();
+
+    benchmark::RegisterBenchmark("queue_contention/ConcurrentList/int", BM_QueueContention<ConcurrentList<int>>)
+        ->ThreadRange(1, 64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark("queue_contention/LockedList/int", BM_QueueContention<LockedList<int>>)
+        ->ThreadRange(1, 64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+    benchmark::RegisterBenchmark("read_mostly/RcuList/int", BM_ReadMostly<RcuList<int>>)
+        ->ThreadRange(1, 64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark("read_mostly/SharedLockedList/int", BM_ReadMostly<SharedLockedList<int>>)
+        ->ThreadRange(1, 64)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
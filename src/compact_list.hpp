@@ -0,0 +1,867 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Компактный двусвязный список: узлы лежат в одном непрерывном массиве
+ *      и связаны 32-битными индексами вместо указателей
+ * @details Освобождённые ячейки попадают в список свободных и переиспользуются.
+ *      При росте массива элементы перемещаются в новый буфер, но индексы ячеек
+ *      не меняются, поэтому итераторы (пара список + индекс) остаются действительными.
+ *      Вмещает не больше ```max_size()``` элементов
+ * @tparam T Тип хранимых элементов
+ * @tparam Alloc Аллокатор элементов; для ячеек перепривязывается к ```Slot```
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class CompactList {
+protected:
+    /// @brief Индекс ячейки
+    using Index = uint32_t;
+
+    /// @brief Отсутствие ячейки (аналог ```nullptr```)
+    static constexpr Index npos = UINT32_MAX;
+
+    /**
+     * @brief Ячейка массива
+     * @details Свободные ячейки связаны через ```nextI```; ```data``` в них не создан
+     */
+    struct Slot {
+        /// @brief Индекс предыдущей ячейки
+        Index prevI = npos;
+
+        /// @brief Индекс следующей ячейки
+        Index nextI = npos;
+
+        union {
+            /// @brief Хранящиеся данные
+            T data;
+        };
+
+        Slot() {}
+        ~Slot() {}
+    };
+
+    using SlotAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Slot>;
+    using SlotAllocTraits = std::allocator_traits<SlotAlloc>;
+    using ValueAllocTraits = std::allocator_traits<Alloc>;
+
+    /**
+     * @brief Переносит ячейки в новый буфер ёмкостью ```newCapacity```
+     * @details Строгая гарантия: при исключении старый буфер остаётся на месте
+     * @param newCapacity Новая ёмкость (не меньше ```_used```)
+     */
+    void reallocate(Index newCapacity);
+
+    /**
+     * @brief Занимает свободную ячейку и конструирует в ней элемент
+     * @param args Аргументы конструктора элемента
+     * @return Индекс ячейки (ещё не связанной со списком)
+     */
+    template <typename... Args>
+    Index createSlot(Args&&... args);
+
+    /// @brief Разрушает элемент ячейки и возвращает её в список свободных
+    /// @param index Индекс ячейки
+    void destroySlot(Index index);
+
+    /// @brief Встраивает ячейку перед ```next```
+    /// @param next Ячейка, перед которой встраивается новая; ```npos``` - в конец
+    /// @param index Встраиваемая ячейка
+    void linkBefore(Index next, Index index);
+
+    /// @brief Вырезает ячейку из списка, не освобождая её
+    /// @param index Индекс ячейки
+    void unlink(Index index);
+
+    /// @brief Разрушает все элементы и освобождает буфер
+    void release();
+
+    /// @brief Обмен содержимым без обмена аллокаторами
+    void swapThis(CompactList& other);
+
+    /// @brief Аллокатор ячеек
+    SlotAlloc _alloc;
+
+    /// @brief Массив ячеек
+    Slot* _slots = nullptr;
+
+    /// @brief Ёмкость массива
+    Index _capacity = 0;
+
+    /// @brief Количество когда-либо занятых ячеек (ячейки за ним ещё не использовались)
+    Index _used = 0;
+
+    /// @brief Первая свободная ячейка среди ```[0, _used)```
+    Index _free = npos;
+
+    /// @brief Индекс первой ячейки списка
+    Index head = npos;
+
+    /// @brief Индекс последней ячейки списка
+    Index tail = npos;
+
+    /// @brief Количество элементов списка
+    size_t _size = 0;
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Создаёт пустой список
+    CompactList();
+
+    /// @brief Создаёт пустой список с заданным аллокатором
+    /// @param alloc Аллокатор
+    explicit CompactList(const Alloc& alloc);
+
+    /**
+     * @brief Заполняет список ```count``` копиями ```value```
+     * @param count Количество элементов
+     * @param value Значение
+     * @param alloc Аллокатор
+     */
+    CompactList(size_t count, const T& value, const Alloc& alloc = Alloc());
+
+    /**
+     * @brief Заполняет список значениями из ```std::initializer_list<T>```
+     * @param initList Список инициализации
+     * @param alloc Аллокатор
+     */
+    CompactList(std::initializer_list<T> initList, const Alloc& alloc = Alloc());
+
+    /// @brief Деструктор
+    ~CompactList();
+
+    /// @brief Конструктор копирования; копия получает плотный массив без свободных ячеек
+    /// @param other Копируемый список
+    CompactList(const CompactList& other);
+
+    /// @brief Конструктор перемещения
+    /// @param other Перемещаемый список
+    CompactList(CompactList&& other) noexcept;
+
+    /// @brief Оператор копирующего присваивания
+    /// @param other Копируемый список
+    /// @return Ссылка на текущий список
+    CompactList& operator=(const CompactList& other);
+
+    /// @brief Оператор перемещающего присваивания
+    /// @details Если аллокаторы не равны и не распространяются, элементы копируются поштучно
+    /// @param other Перемещаемый список
+    /// @return Ссылка на текущий список
+    CompactList& operator=(CompactList&& other);
+
+    /// @brief Возвращает копию аллокатора списка
+    /// @return Аллокатор элементов
+    Alloc get_allocator() const;
+
+    /**
+     * @brief Двунаправленный итератор по индексам ячеек
+     * @details Хранит список и индекс, поэтому не теряет действительность при росте массива
+     * @tparam IsConst ```true``` для итератора на константные элементы
+     */
+    template <bool IsConst>
+    struct BasicIterator {
+        friend class CompactList;
+        template <bool> friend struct BasicIterator;
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using Owner = std::conditional_t<IsConst, const CompactList, CompactList>;
+
+        /// @brief Создаёт итератор, не связанный ни с одним списком
+        BasicIterator() = default;
+
+        /// @brief Конструирование на основе индекса
+        /// @param owner Список
+        /// @param index Индекс ячейки; ```npos``` - ```end()```
+        BasicIterator(Owner* owner, Index index) : owner(owner), index(index) {}
+
+        /// @brief Преобразование итератора в константный
+        /// @param other Неконстантный итератор
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) : owner(other.owner), index(other.index) {}
+
+        /// @brief Пре-инкрементный сдвиг на следующий элемент
+        /// @return Итератор на следующий элемент
+        BasicIterator& operator++() {
+            index = owner->_slots[index].nextI;
+            return *this;
+        }
+
+        /// @brief Пост-инкрементный сдвиг на следующий элемент
+        /// @return Итератор до сдвига
+        BasicIterator operator++(int) {
+            BasicIterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        /// @brief Пре-декрементный сдвиг на предыдущий элемент; от ```end()``` - к последнему
+        /// @return Итератор на предыдущий элемент
+        BasicIterator& operator--() {
+            index = index != npos ? owner->_slots[index].prevI : owner->tail;
+            return *this;
+        }
+
+        /// @brief Пост-декрементный сдвиг на предыдущий элемент
+        /// @return Итератор до сдвига
+        BasicIterator operator--(int) {
+            BasicIterator old = *this;
+            --(*this);
+            return old;
+        }
+
+        /// @brief Сравнение двух итераторов
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator==(const BasicIterator<OtherConst>& other) const { return index == other.index; }
+
+        /// @brief Проверка на неравенство двух итераторов
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator!=(const BasicIterator<OtherConst>& other) const { return index != other.index; }
+
+        /// @brief Доступ к элементу
+        /// @return Ссылка на элемент
+        reference operator*() const { return owner->_slots[index].data; }
+
+        /// @brief Доступ к членам элемента
+        /// @return Указатель на элемент
+        pointer operator->() const { return std::addressof(owner->_slots[index].data); }
+
+    protected:
+        /// @brief Список, по которому идёт обход
+        Owner* owner = nullptr;
+
+        /// @brief Индекс текущей ячейки
+        Index index = npos;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    /// @brief Поэлементное сравнение двух списков
+    /// @param other Сравниваемый список
+    /// @return Результат сравнения
+    bool operator==(const CompactList& other) const;
+
+    /// @brief Поэлементная проверка на неравенство двух списков
+    /// @param other Сравниваемый список
+    /// @return Результат сравнения
+    bool operator!=(const CompactList& other) const;
+
+    /// @brief Доступ к первому элементу списка
+    /// @return Первый элемент
+    T& front();
+
+    /// @copydoc front()
+    const T& front() const;
+
+    /// @brief Доступ к последнему элементу списка
+    /// @return Последний элемент
+    T& back();
+
+    /// @copydoc back()
+    const T& back() const;
+
+    /// @brief Добавление в начало списка
+    /// @param data Добавляемые данные
+    void push_front(const T& data);
+
+    /// @brief Добавление в начало списка перемещением
+    /// @param data Перемещаемые данные
+    void push_front(T&& data);
+
+    /// @brief Добавление в конец списка
+    /// @param data Добавляемые данные
+    void push_back(const T& data);
+
+    /// @brief Добавление в конец списка перемещением
+    /// @param data Перемещаемые данные
+    void push_back(T&& data);
+
+    /// @brief Конструирует элемент в начале списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_front(Args&&... args);
+
+    /// @brief Конструирует элемент в конце списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+
+    /// @brief Удаление из начала списка
+    void pop_front();
+
+    /// @brief Удаление из конца списка
+    void pop_back();
+
+    /// @brief Вставка элемента в позицию
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param value Вставляемое значение
+    /// @return Итератор на вставленный элемент
+    Iterator insert(ConstIterator pos, const T& value);
+
+    /// @brief Вставка элемента в позицию перемещением
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param value Перемещаемое значение
+    /// @return Итератор на вставленный элемент
+    Iterator insert(ConstIterator pos, T&& value);
+
+    /// @brief Конструирует элемент перед ```pos```
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param args Аргументы конструктора элемента
+    /// @return Итератор на созданный элемент
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args);
+
+    /// @brief Удаление элемента в позиции; ячейка переиспользуется следующей вставкой
+    /// @param pos Позиция удаляемого элемента
+    /// @return Итератор на следующий элемент
+    Iterator erase(ConstIterator pos);
+
+    /// @brief Удаление элементов в диапазоне [```first```, ```last```)
+    /// @param first Первый удаляемый элемент
+    /// @param last Элемент, до которого идёт удаление
+    /// @return Итератор на элемент ```last```
+    Iterator erase(ConstIterator first, ConstIterator last);
+
+    /// @brief Сортирует элементы списка
+    void sort();
+
+    /// @brief Устойчиво сортирует элементы списка с помощью компаратора
+    /// @details Элементы не перемещаются: сортируется вспомогательный массив
+    ///     индексов (4 байта на элемент), после чего ячейки перевязываются
+    /// @param comp Компаратор: ```true```, если первый элемент строго меньше второго
+    template <typename Compare>
+    void sort(Compare comp);
+
+    /// @brief Оборачивание списка (элементы в обратном порядке)
+    void reverse();
+
+    /// @brief Удаляет все элементы; ёмкость массива сохраняется
+    void clear();
+
+    /// @brief Резервирует массив под ```count``` элементов
+    /// @param count Требуемая ёмкость
+    void reserve(size_t count);
+
+    /// @brief Ёмкость массива ячеек
+    /// @return Количество элементов, которые поместятся без перевыделения
+    size_t capacity() const;
+
+    /// @brief Проверка на наличие элементов в списке
+    /// @return ```true```, если список пустой
+    bool empty() const;
+
+    /// @brief Возвращает размер списка
+    /// @return Количество элементов списка
+    size_t size() const;
+
+    /// @brief Наибольший возможный размер списка
+    /// @return ```2^32 - 2```
+    static constexpr size_t max_size() { return npos - 1; }
+
+    Iterator begin();
+    ConstIterator begin() const;
+    Iterator end();
+    ConstIterator end() const;
+    ConstIterator cbegin() const;
+    ConstIterator cend() const;
+    reverse_iterator rbegin();
+    const_reverse_iterator rbegin() const;
+    reverse_iterator rend();
+    const_reverse_iterator rend() const;
+};
+
+template <typename T, typename Alloc>
+CompactList<T, Alloc>::CompactList() : CompactList(Alloc()) {}
+
+template <typename T, typename Alloc>
+CompactList<T, Alloc>::CompactList(const Alloc& alloc) : _alloc(alloc) {}
+
+template <typename T, typename Alloc>
+CompactList<T, Alloc>::CompactList(size_t count, const T& value, const Alloc& alloc) : CompactList(alloc) {
+    reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        push_back(value);
+    }
+}
+
+template <typename T, typename Alloc>
+CompactList<T, Alloc>::CompactList(std::initializer_list<T> initList, const Alloc& alloc) : CompactList(alloc) {
+    reserve(initList.size());
+    for (const T& elem : initList) {
+        push_back(elem);
+    }
+}
+
+template <typename T, typename Alloc>
+CompactList<T, Alloc>::~CompactList() {
+    release();
+}
+
+template <typename T, typename Alloc>
+CompactList<T, Alloc>::CompactList(const CompactList& other)
+    : CompactList(ValueAllocTraits::select_on_container_copy_construction(other.get_allocator())) {
+    reserve(other._size);
+    for (const T& elem : other) {
+        push_back(elem);
+    }
+}
+
+template <typename T, typename Alloc>
+CompactList<T, Alloc>::CompactList(CompactList&& other) noexcept : _alloc(std::move(other._alloc)) {
+    swapThis(other);
+}
+
+template <typename T, typename Alloc>
+CompactList<T, Alloc>& CompactList<T, Alloc>::operator=(const CompactList& other) {
+    if (this != &other) {
+        CompactList tmp(other);
+        *this = std::move(tmp);
+    }
+    return *this;
+}
+
+template <typename T, typename Alloc>
+CompactList<T, Alloc>& CompactList<T, Alloc>::operator=(CompactList&& other) {
+    if (this == &other) {
+        return *this;
+    }
+    release();
+    if constexpr (SlotAllocTraits::propagate_on_container_move_assignment::value) {
+        _alloc = std::move(other._alloc);
+    }
+    else if (_alloc != other._alloc) {
+        reserve(other._size);
+        for (T& elem : other) {
+            push_back(std::move(elem));
+        }
+        other.clear();
+        return *this;
+    }
+    swapThis(other);
+    return *this;
+}
+
+template <typename T, typename Alloc>
+Alloc CompactList<T, Alloc>::get_allocator() const {
+    return Alloc(_alloc);
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::swapThis(CompactList& other) {
+    std::swap(_slots, other._slots);
+    std::swap(_capacity, other._capacity);
+    std::swap(_used, other._used);
+    std::swap(_free, other._free);
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(_size, other._size);
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::release() {
+    clear();
+    if (_slots != nullptr) {
+        SlotAllocTraits::deallocate(_alloc, _slots, _capacity);
+    }
+    _slots = nullptr;
+    _capacity = _used = 0;
+    _free = npos;
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::reallocate(Index newCapacity) {
+    Slot* slots = SlotAllocTraits::allocate(_alloc, newCapacity);
+    Alloc valueAlloc(_alloc);
+    Index moved = head;
+    try {
+        // ячейки за ```_used``` создаются по мере занятия в ```createSlot```, чтобы
+        // не трогать страницы ещё не использованной части буфера
+        for (Index i = 0; i < _used; ++i) {
+            ::new (static_cast<void*>(slots + i)) Slot();
+            slots[i].prevI = _slots[i].prevI;
+            slots[i].nextI = _slots[i].nextI;
+        }
+        for (; moved != npos; moved = _slots[moved].nextI) {
+            ValueAllocTraits::construct(valueAlloc, std::addressof(slots[moved].data),
+                                        std::move_if_noexcept(_slots[moved].data));
+        }
+    }
+    catch (...) {
+        for (Index i = head; i != moved; i = _slots[i].nextI) {
+            ValueAllocTraits::destroy(valueAlloc, std::addressof(slots[i].data));
+        }
+        SlotAllocTraits::deallocate(_alloc, slots, newCapacity);
+        throw;
+    }
+    for (Index i = head; i != npos; i = _slots[i].nextI) {
+        ValueAllocTraits::destroy(valueAlloc, std::addressof(_slots[i].data));
+    }
+    if (_slots != nullptr) {
+        SlotAllocTraits::deallocate(_alloc, _slots, _capacity);
+    }
+    _slots = slots;
+    _capacity = newCapacity;
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+typename CompactList<T, Alloc>::Index CompactList<T, Alloc>::createSlot(Args&&... args) {
+    Index index = _free;
+    if (index == npos) {
+        if (_used == _capacity) {
+            if (_capacity == max_size()) {
+                throw std::length_error("CompactList is full");
+            }
+            // аргументы могут ссылаться на элементы этого же списка, поэтому значение
+            // создаётся до переноса массива
+            T value(std::forward<Args>(args)...);
+            size_t grown = std::max<size_t>(8, size_t(_capacity) * 2);
+            reallocate(static_cast<Index>(std::min(grown, max_size())));
+            return createSlot(std::move(value));
+        }
+        index = _used;
+        ::new (static_cast<void*>(_slots + index)) Slot();
+    }
+    Alloc valueAlloc(_alloc);
+    ValueAllocTraits::construct(valueAlloc, std::addressof(_slots[index].data), std::forward<Args>(args)...);
+    if (index == _used) {
+        ++_used;
+    }
+    else {
+        _free = _slots[index].nextI;
+    }
+    return index;
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::destroySlot(Index index) {
+    Alloc valueAlloc(_alloc);
+    ValueAllocTraits::destroy(valueAlloc, std::addressof(_slots[index].data));
+    _slots[index].prevI = npos;
+    _slots[index].nextI = _free;
+    _free = index;
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::linkBefore(Index next, Index index) {
+    Index prev = next != npos ? _slots[next].prevI : tail;
+    _slots[index].prevI = prev;
+    _slots[index].nextI = next;
+
+    if (prev != npos) {
+        _slots[prev].nextI = index;
+    }
+    else {
+        head = index;
+    }
+    if (next != npos) {
+        _slots[next].prevI = index;
+    }
+    else {
+        tail = index;
+    }
+    ++_size;
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::unlink(Index index) {
+    Index prev = _slots[index].prevI;
+    Index next = _slots[index].nextI;
+    if (prev != npos) {
+        _slots[prev].nextI = next;
+    }
+    else {
+        head = next;
+    }
+    if (next != npos) {
+        _slots[next].prevI = prev;
+    }
+    else {
+        tail = prev;
+    }
+    --_size;
+}
+
+template <typename T, typename Alloc>
+bool CompactList<T, Alloc>::operator==(const CompactList& other) const {
+    return _size == other._size && std::equal(begin(), end(), other.begin());
+}
+
+template <typename T, typename Alloc>
+bool CompactList<T, Alloc>::operator!=(const CompactList& other) const {
+    return !(*this == other);
+}
+
+template <typename T, typename Alloc>
+T& CompactList<T, Alloc>::front() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return _slots[head].data;
+}
+
+template <typename T, typename Alloc>
+const T& CompactList<T, Alloc>::front() const {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return _slots[head].data;
+}
+
+template <typename T, typename Alloc>
+T& CompactList<T, Alloc>::back() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return _slots[tail].data;
+}
+
+template <typename T, typename Alloc>
+const T& CompactList<T, Alloc>::back() const {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return _slots[tail].data;
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::push_front(T&& data) {
+    emplace_front(std::move(data));
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+T& CompactList<T, Alloc>::emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+T& CompactList<T, Alloc>::emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(begin());
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(ConstIterator(this, tail));
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::Iterator CompactList<T, Alloc>::insert(ConstIterator pos, const T& value) {
+    return emplace(pos, value);
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::Iterator CompactList<T, Alloc>::insert(ConstIterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+typename CompactList<T, Alloc>::Iterator CompactList<T, Alloc>::emplace(ConstIterator pos, Args&&... args) {
+    // индекс позиции переживает перевыделение массива внутри createSlot
+    Index index = createSlot(std::forward<Args>(args)...);
+    linkBefore(pos.index, index);
+    return Iterator(this, index);
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::Iterator CompactList<T, Alloc>::erase(ConstIterator pos) {
+    if (empty()) {
+        throw std::out_of_range("Trying to erase in empty list!");
+    }
+    if (pos.index == npos) {
+        throw std::out_of_range("Invalid erasing");
+    }
+    Index next = _slots[pos.index].nextI;
+    unlink(pos.index);
+    destroySlot(pos.index);
+    return Iterator(this, next);
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::Iterator CompactList<T, Alloc>::erase(ConstIterator first, ConstIterator last) {
+    while (first != last) {
+        first = erase(first);
+    }
+    return Iterator(this, last.index);
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::sort() {
+    sort(std::less<T>());
+}
+
+template <typename T, typename Alloc>
+template <typename Compare>
+void CompactList<T, Alloc>::sort(Compare comp) {
+    if (_size < 2) {
+        return;
+    }
+    std::vector<Index> order;
+    order.reserve(_size);
+    for (Index i = head; i != npos; i = _slots[i].nextI) {
+        order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [this, &comp](Index left, Index right) {
+        return comp(_slots[left].data, _slots[right].data);
+    });
+
+    Index prev = npos;
+    for (Index index : order) {
+        _slots[index].prevI = prev;
+        if (prev != npos) {
+            _slots[prev].nextI = index;
+        }
+        prev = index;
+    }
+    _slots[prev].nextI = npos;
+    head = order.front();
+    tail = prev;
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::reverse() {
+    for (Index i = head; i != npos; i = _slots[i].prevI) {
+        std::swap(_slots[i].prevI, _slots[i].nextI);
+    }
+    std::swap(head, tail);
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::clear() {
+    Alloc valueAlloc(_alloc);
+    for (Index i = head; i != npos; i = _slots[i].nextI) {
+        ValueAllocTraits::destroy(valueAlloc, std::addressof(_slots[i].data));
+    }
+    head = tail = npos;
+    _size = 0;
+    _used = 0;
+    _free = npos;
+}
+
+template <typename T, typename Alloc>
+void CompactList<T, Alloc>::reserve(size_t count) {
+    if (count > max_size()) {
+        throw std::length_error("CompactList is full");
+    }
+    if (count > _capacity) {
+        reallocate(static_cast<Index>(count));
+    }
+}
+
+template <typename T, typename Alloc>
+size_t CompactList<T, Alloc>::capacity() const {
+    return _capacity;
+}
+
+template <typename T, typename Alloc>
+bool CompactList<T, Alloc>::empty() const {
+    return _size == 0;
+}
+
+template <typename T, typename Alloc>
+size_t CompactList<T, Alloc>::size() const {
+    return _size;
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::Iterator CompactList<T, Alloc>::begin() {
+    return Iterator(this, head);
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::ConstIterator CompactList<T, Alloc>::begin() const {
+    return ConstIterator(this, head);
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::Iterator CompactList<T, Alloc>::end() {
+    return Iterator(this, npos);
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::ConstIterator CompactList<T, Alloc>::end() const {
+    return ConstIterator(this, npos);
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::ConstIterator CompactList<T, Alloc>::cbegin() const {
+    return begin();
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::ConstIterator CompactList<T, Alloc>::cend() const {
+    return end();
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::reverse_iterator CompactList<T, Alloc>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::const_reverse_iterator CompactList<T, Alloc>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::reverse_iterator CompactList<T, Alloc>::rend() {
+    return reverse_iterator(begin());
+}
+
+template <typename T, typename Alloc>
+typename CompactList<T, Alloc>::const_reverse_iterator CompactList<T, Alloc>::rend() const {
+    return const_reverse_iterator(begin());
+}
@@ -0,0 +1,461 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+/**
+ * @brief Потокобезопасный двусвязный список для очередей задач (MPMC)
+ * @details Узлы устроены так же, как у ```List```, но концы списка защищены
+ *      разными мьютексами, поэтому операции с началом и с концом идут параллельно.
+ *      Счётчик ```_count``` учитывает только доступные для извлечения элементы:
+ *      извлечение сначала резервирует элемент (уменьшает счётчик), а вставка
+ *      увеличивает его уже после связывания узла. Пока элементов достаточно,
+ *      каждой операции хватает мьютекса своего конца; иначе берутся оба.
+ *      Память под узлы выделяется и освобождается вне критических секций.
+ *      Методов ```front()```/```back()``` нет намеренно: извлечение атомарно
+ *      только через ```try_pop_*```/```wait_pop_*```
+ * @tparam T Тип хранимых элементов
+ * @tparam Alloc Аллокатор элементов; должен быть потокобезопасным
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class ConcurrentList {
+protected:
+    /// @brief Связи узла; сами по себе используются как ограничители концов
+    struct Link {
+        /// @brief Указатель на предыдущий узел
+        Link* prevP = nullptr;
+
+        /// @brief Указатель на следующий узел
+        Link* nextP = nullptr;
+    };
+
+    /// @brief Узел с элементом
+    struct Node : Link {
+        union {
+            /// @brief Хранящиеся данные
+            T data;
+        };
+
+        Node() {}
+        ~Node() {}
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
+    using ValueAllocTraits = std::allocator_traits<Alloc>;
+
+    /// @brief Сколько элементов должно остаться после резервирования, чтобы
+    ///     извлечение не задело узлы, с которыми работает другой конец
+    static constexpr size_t popReserve = 2;
+
+    /// @brief Сколько элементов достаточно для вставки под одним мьютексом
+    static constexpr size_t pushReserve = 2;
+
+    /**
+     * @brief Выделяет узел и конструирует в нём элемент
+     * @param args Аргументы конструктора элемента
+     * @return Указатель на новый узел
+     */
+    template <typename... Args>
+    Node* createNode(Args&&... args);
+
+    /// @brief Разрушает элемент узла и освобождает узел
+    /// @param node Указатель на узел
+    void destroyNode(Node* node);
+
+    /// @brief Встраивает узел между ```prev``` и ```next```
+    static void link(Link* prev, Link* next, Link* node);
+
+    /// @brief Вырезает узел из цепочки
+    static void unlink(Link* node);
+
+    /// @brief Встраивает узел в начало или конец и публикует его в ```_count```
+    /// @details Вызывается под мьютексом нужного конца (или под обоими)
+    /// @param front ```true``` для вставки в начало
+    /// @param node Встраиваемый узел
+    void linkEnd(bool front, Node* node);
+
+    /// @brief Вставляет узел в начало или конец, выбирая нужные мьютексы
+    /// @param front ```true``` для вставки в начало
+    /// @param node Встраиваемый узел
+    void pushNode(bool front, Node* node);
+
+    /// @brief Вырезает крайний узел без ожидания
+    /// @param front ```true``` для извлечения из начала
+    /// @return Вырезанный узел или ```nullptr```, если список пуст
+    Node* popNode(bool front);
+
+    /// @brief Пытается зарезервировать элемент, оставив не меньше ```popReserve```
+    /// @return ```true```, если резерв получен
+    bool reserveFast();
+
+    /// @brief Перемещает элемент узла в ```out``` и освобождает узел
+    void release(Node* node, T& out);
+
+    /// @brief Будит одного ожидающего в ```wait_pop_*```, если такие есть
+    void notifyWaiter();
+
+    /// @brief Ожидает элемент с нужного конца
+    bool waitPop(bool front, T& out);
+
+    /// @brief Аллокатор узлов
+    NodeAlloc _alloc;
+
+    /// @brief Ограничитель перед первым элементом
+    Link _head;
+
+    /// @brief Ограничитель после последнего элемента
+    Link _tail;
+
+    /// @brief Защищает ```_head.nextP``` и первый узел
+    alignas(64) std::mutex _headMutex;
+
+    /// @brief Защищает ```_tail.prevP``` и последний узел
+    alignas(64) std::mutex _tailMutex;
+
+    /// @brief Количество элементов, доступных для извлечения
+    alignas(64) std::atomic<size_t> _count{0};
+
+    /// @brief Количество потоков, ожидающих в ```wait_pop_*```
+    std::atomic<size_t> _waiters{0};
+
+    /// @brief Флаг закрытия очереди
+    std::atomic<bool> _closed{false};
+
+    /// @brief Мьютекс для ```_cond```
+    std::mutex _waitMutex;
+
+    /// @brief Условная переменная для ```wait_pop_*```
+    std::condition_variable _cond;
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+
+    /// @brief Создаёт пустой список
+    /// @param alloc Аллокатор
+    explicit ConcurrentList(const Alloc& alloc = Alloc());
+
+    /// @brief Освобождает оставшиеся элементы; не должен выполняться параллельно с другими методами
+    ~ConcurrentList();
+
+    ConcurrentList(const ConcurrentList&) = delete;
+    ConcurrentList& operator=(const ConcurrentList&) = delete;
+
+    /// @brief Добавление в начало списка
+    /// @param data Добавляемые данные
+    void push_front(const T& data);
+
+    /// @brief Добавление в начало списка перемещением
+    /// @param data Перемещаемые данные
+    void push_front(T&& data);
+
+    /// @brief Добавление в конец списка
+    /// @param data Добавляемые данные
+    void push_back(const T& data);
+
+    /// @brief Добавление в конец списка перемещением
+    /// @param data Перемещаемые данные
+    void push_back(T&& data);
+
+    /// @brief Конструирует элемент в начале списка
+    /// @param args Аргументы конструктора элемента
+    template <typename... Args>
+    void emplace_front(Args&&... args);
+
+    /// @brief Конструирует элемент в конце списка
+    /// @param args Аргументы конструктора элемента
+    template <typename... Args>
+    void emplace_back(Args&&... args);
+
+    /// @brief Атомарно извлекает первый элемент, если он есть
+    /// @details Если присваивание ```out``` бросает исключение, элемент теряется
+    /// @param out Куда перемещается извлечённый элемент
+    /// @return ```true```, если элемент извлечён
+    bool try_pop_front(T& out);
+
+    /// @brief Атомарно извлекает последний элемент, если он есть
+    /// @param out Куда перемещается извлечённый элемент
+    /// @return ```true```, если элемент извлечён
+    bool try_pop_back(T& out);
+
+    /// @brief Извлекает первый элемент, ожидая его появления
+    /// @param out Куда перемещается извлечённый элемент
+    /// @return ```false```, если список закрыт (```close()```) и пуст
+    bool wait_pop_front(T& out);
+
+    /// @brief Извлекает последний элемент, ожидая его появления
+    /// @param out Куда перемещается извлечённый элемент
+    /// @return ```false```, если список закрыт (```close()```) и пуст
+    bool wait_pop_back(T& out);
+
+    /// @brief Закрывает список: ожидающие потоки просыпаются, а ```wait_pop_*```
+    ///     на пустом списке больше не блокируется. Вставка остаётся разрешённой
+    void close();
+
+    /// @brief Проверка, закрыт ли список
+    /// @return ```true```, если вызывался ```close()```
+    bool closed() const;
+
+    /// @brief Количество элементов
+    /// @return Снимок размера; при параллельных операциях сразу устаревает
+    size_t size() const;
+
+    /// @brief Проверка на наличие элементов
+    /// @return Снимок: ```true```, если элементов нет
+    bool empty() const;
+
+    /// @brief Возвращает копию аллокатора списка
+    /// @return Аллокатор элементов
+    Alloc get_allocator() const;
+};
+
+template <typename T, typename Alloc>
+ConcurrentList<T, Alloc>::ConcurrentList(const Alloc& alloc) : _alloc(alloc) {
+    _head.nextP = &_tail;
+    _tail.prevP = &_head;
+}
+
+template <typename T, typename Alloc>
+ConcurrentList<T, Alloc>::~ConcurrentList() {
+    Link* current = _head.nextP;
+    while (current != &_tail) {
+        Link* next = current->nextP;
+        destroyNode(static_cast<Node*>(current));
+        current = next;
+    }
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+typename ConcurrentList<T, Alloc>::Node* ConcurrentList<T, Alloc>::createNode(Args&&... args) {
+    Node* node = NodeAllocTraits::allocate(_alloc, 1);
+    ::new (static_cast<void*>(node)) Node();
+    try {
+        Alloc valueAlloc(_alloc);
+        ValueAllocTraits::construct(valueAlloc, std::addressof(node->data), std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node->~Node();
+        NodeAllocTraits::deallocate(_alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::destroyNode(Node* node) {
+    Alloc valueAlloc(_alloc);
+    ValueAllocTraits::destroy(valueAlloc, std::addressof(node->data));
+    node->~Node();
+    NodeAllocTraits::deallocate(_alloc, node, 1);
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::link(Link* prev, Link* next, Link* node) {
+    node->prevP = prev;
+    node->nextP = next;
+    prev->nextP = node;
+    next->prevP = node;
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::unlink(Link* node) {
+    node->prevP->nextP = node->nextP;
+    node->nextP->prevP = node->prevP;
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::linkEnd(bool front, Node* node) {
+    if (front) {
+        link(&_head, _head.nextP, node);
+    }
+    else {
+        link(_tail.prevP, &_tail, node);
+    }
+    _count.fetch_add(1);
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::pushNode(bool front, Node* node) {
+    bool linked = false;
+    {
+        // другой конец извлекает только при _count > popReserve, а вставляет при
+        // _count >= pushReserve; в обоих случаях его узлы не пересекаются с нашим
+        std::lock_guard<std::mutex> lock(front ? _headMutex : _tailMutex);
+        if (_count.load() >= pushReserve) {
+            linkEnd(front, node);
+            linked = true;
+        }
+    }
+    if (!linked) {
+        std::scoped_lock lock(_headMutex, _tailMutex);
+        linkEnd(front, node);
+    }
+    // будим ожидающих вне мьютексов концов: ожидающий держит _waitMutex и берёт их
+    notifyWaiter();
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentList<T, Alloc>::reserveFast() {
+    size_t count = _count.load();
+    while (count > popReserve) {
+        if (_count.compare_exchange_weak(count, count - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T, typename Alloc>
+typename ConcurrentList<T, Alloc>::Node* ConcurrentList<T, Alloc>::popNode(bool front) {
+    {
+        std::lock_guard<std::mutex> lock(front ? _headMutex : _tailMutex);
+        if (reserveFast()) {
+            Link* node = front ? _head.nextP : _tail.prevP;
+            unlink(node);
+            return static_cast<Node*>(node);
+        }
+    }
+    std::scoped_lock lock(_headMutex, _tailMutex);
+    // под обоими мьютексами незавершённых операций нет, и _count точен
+    if (_count.load() == 0) {
+        return nullptr;
+    }
+    _count.fetch_sub(1);
+    Link* node = front ? _head.nextP : _tail.prevP;
+    unlink(node);
+    return static_cast<Node*>(node);
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::release(Node* node, T& out) {
+    try {
+        out = std::move(node->data);
+    }
+    catch (...) {
+        destroyNode(node);
+        throw;
+    }
+    destroyNode(node);
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::notifyWaiter() {
+    if (_waiters.load() != 0) {
+        std::lock_guard<std::mutex> lock(_waitMutex);
+        _cond.notify_one();
+    }
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentList<T, Alloc>::waitPop(bool front, T& out) {
+    Node* node = popNode(front);
+    if (node == nullptr) {
+        _waiters.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(_waitMutex);
+            while ((node = popNode(front)) == nullptr && !_closed.load()) {
+                _cond.wait(lock);
+            }
+        }
+        _waiters.fetch_sub(1);
+        if (node == nullptr) {
+            return false;
+        }
+    }
+    release(node, out);
+    return true;
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::push_front(T&& data) {
+    emplace_front(std::move(data));
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+void ConcurrentList<T, Alloc>::emplace_front(Args&&... args) {
+    pushNode(true, createNode(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+void ConcurrentList<T, Alloc>::emplace_back(Args&&... args) {
+    pushNode(false, createNode(std::forward<Args>(args)...));
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentList<T, Alloc>::try_pop_front(T& out) {
+    Node* node = popNode(true);
+    if (node == nullptr) {
+        return false;
+    }
+    release(node, out);
+    return true;
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentList<T, Alloc>::try_pop_back(T& out) {
+    Node* node = popNode(false);
+    if (node == nullptr) {
+        return false;
+    }
+    release(node, out);
+    return true;
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentList<T, Alloc>::wait_pop_front(T& out) {
+    return waitPop(true, out);
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentList<T, Alloc>::wait_pop_back(T& out) {
+    return waitPop(false, out);
+}
+
+template <typename T, typename Alloc>
+void ConcurrentList<T, Alloc>::close() {
+    _closed.store(true);
+    std::lock_guard<std::mutex> lock(_waitMutex);
+    _cond.notify_all();
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentList<T, Alloc>::closed() const {
+    return _closed.load();
+}
+
+template <typename T, typename Alloc>
+size_t ConcurrentList<T, Alloc>::size() const {
+    return _count.load();
+}
+
+template <typename T, typename Alloc>
+bool ConcurrentList<T, Alloc>::empty() const {
+    return size() == 0;
+}
+
+template <typename T, typename Alloc>
+Alloc ConcurrentList<T, Alloc>::get_allocator() const {
+    return Alloc(_alloc);
+}
@@ -0,0 +1,452 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "list.hpp"
+
+/**
+ * @brief Список с копированием при записи
+ * @details Элементы хранятся сегментами - обычными ```List``` не длиннее
+ *      ```2 * segmentSize``` узлов. Сегменты и их оглавление разделяются копиями
+ *      через счётчики ссылок, поэтому копирование списка - O(1). Первое изменение
+ *      копии отделяет оглавление (O(n / segmentSize) указателей) и только тот
+ *      сегмент, который меняется (O(segmentSize) элементов); остальные сегменты
+ *      остаются общими. Чтение через константные методы и итераторы ничего не копирует.
+ *      Итераторы только константные: элементы меняются методами списка, а любое
+ *      изменение делает итераторы недействительными. Разные копии можно менять
+ *      из разных потоков одновременно, один объект - нет
+ * @tparam T Тип хранимых элементов
+ * @tparam Alloc Аллокатор узлов сегментов
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class CowList {
+    using Segment = List<T, Alloc>;
+    using SegmentPtr = std::shared_ptr<Segment>;
+    using SegmentIterator = typename Segment::ConstIterator;
+
+    /// @brief Оглавление: сегменты по порядку (пустых нет) и общее число элементов
+    struct Spine {
+        std::vector<SegmentPtr> segments;
+        size_t size = 0;
+    };
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    /// @brief Длина сегмента при заполнении; сегмент делится пополам, когда превышает её вдвое
+    static constexpr size_t segmentSize = 64;
+
+    /// @brief Константный двунаправленный итератор
+    class ConstIterator {
+        friend class CowList;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        /// @brief Создаёт итератор, не связанный ни с одним списком
+        ConstIterator() = default;
+
+        const T& operator*() const { return *it; }
+        const T* operator->() const { return &*it; }
+
+        /// @brief Сдвиг на один элемент вперёд
+        ConstIterator& operator++() {
+            ++it;
+            if (it == spine->segments[segment]->cend()) {
+                ++segment;
+                it = segment < spine->segments.size() ? spine->segments[segment]->cbegin() : SegmentIterator();
+            }
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        /// @brief Сдвиг на один элемент назад
+        ConstIterator& operator--() {
+            if (segment == spine->segments.size() || it == spine->segments[segment]->cbegin()) {
+                --segment;
+                it = spine->segments[segment]->cend();
+            }
+            --it;
+            return *this;
+        }
+
+        ConstIterator operator--(int) {
+            ConstIterator old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const ConstIterator& other) const {
+            return spine == other.spine && segment == other.segment && it == other.it;
+        }
+
+        bool operator!=(const ConstIterator& other) const { return !(*this == other); }
+
+    private:
+        ConstIterator(const Spine* spine, size_t segment, SegmentIterator it)
+            : spine(spine), segment(segment), it(it) {}
+
+        /// @brief Оглавление списка
+        const Spine* spine = nullptr;
+
+        /// @brief Номер сегмента; ```segments.size()``` у ```end()```
+        size_t segment = 0;
+
+        /// @brief Позиция в сегменте
+        SegmentIterator it;
+    };
+
+    using const_iterator = ConstIterator;
+    using iterator = ConstIterator;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+    using reverse_iterator = const_reverse_iterator;
+
+    /// @brief Создаёт пустой список
+    CowList() = default;
+
+    /// @brief Создаёт пустой список с аллокатором
+    /// @param alloc Аллокатор узлов
+    explicit CowList(const Alloc& alloc) : _alloc(alloc) {}
+
+    /**
+     * @brief Заполняет список ```count``` копиями ```value```
+     * @param count Количество элементов
+     * @param value Значение
+     * @param alloc Аллокатор узлов
+     */
+    CowList(size_t count, const T& value, const Alloc& alloc = Alloc()) : _alloc(alloc) {
+        for (size_t i = 0; i < count; ++i) {
+            appendFilled(value);
+        }
+    }
+
+    /// @brief Заполняет список значениями из ```std::initializer_list<T>```
+    /// @param initList Список инициализации
+    /// @param alloc Аллокатор узлов
+    CowList(std::initializer_list<T> initList, const Alloc& alloc = Alloc()) : _alloc(alloc) {
+        for (const T& value : initList) {
+            appendFilled(value);
+        }
+    }
+
+    /// @brief Конструктор копирования за O(1): копия разделяет сегменты с ```other```
+    /// @param other Копируемый список
+    CowList(const CowList& other)
+        : _spine(other._spine),
+          _alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(other._alloc)) {}
+
+    /// @brief Конструктор перемещения
+    /// @param other Перемещаемый список
+    CowList(CowList&& other) noexcept : _spine(std::move(other._spine)), _alloc(other._alloc) {}
+
+    /// @brief Оператор копирующего присваивания за O(1)
+    /// @param other Копируемый список
+    /// @return Ссылка на текущий список
+    CowList& operator=(const CowList& other) {
+        _spine = other._spine;
+        return *this;
+    }
+
+    /// @brief Оператор перемещающего присваивания
+    /// @param other Перемещаемый список
+    /// @return Ссылка на текущий список
+    CowList& operator=(CowList&& other) noexcept {
+        _spine = std::move(other._spine);
+        return *this;
+    }
+
+    /// @brief Аллокатор, которым создаются новые сегменты
+    Alloc get_allocator() const { return _alloc; }
+
+    /// @brief Разделяет ли список элементы с другой копией
+    /// @return ```true```, если следующее изменение скопирует оглавление
+    bool shared() const { return _spine != nullptr && _spine.use_count() > 1; }
+
+    size_t size() const { return _spine != nullptr ? _spine->size : 0; }
+    bool empty() const { return size() == 0; }
+
+    /// @brief Сравнение поэлементно
+    /// @param other Сравниваемый список
+    /// @return ```true```, если элементы равны
+    bool operator==(const CowList& other) const {
+        return _spine == other._spine
+            || (size() == other.size() && std::equal(cbegin(), cend(), other.cbegin()));
+    }
+
+    bool operator!=(const CowList& other) const { return !(*this == other); }
+
+    ConstIterator begin() const { return cbegin(); }
+    ConstIterator end() const { return cend(); }
+
+    ConstIterator cbegin() const {
+        return empty() ? cend() : ConstIterator(_spine.get(), 0, _spine->segments.front()->cbegin());
+    }
+
+    ConstIterator cend() const {
+        return ConstIterator(_spine.get(), _spine != nullptr ? _spine->segments.size() : 0, SegmentIterator());
+    }
+
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(cend()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(cbegin()); }
+
+    /// @brief Первый элемент без копирования
+    /// @exception std::out_of_range Если список пуст
+    const T& front() const {
+        checkNotEmpty();
+        return _spine->segments.front()->front();
+    }
+
+    /// @brief Последний элемент без копирования
+    /// @exception std::out_of_range Если список пуст
+    const T& back() const {
+        checkNotEmpty();
+        return _spine->segments.back()->back();
+    }
+
+    /// @brief Первый элемент для изменения; отделяет первый сегмент
+    /// @exception std::out_of_range Если список пуст
+    T& front() {
+        checkNotEmpty();
+        mutableSpine();
+        return mutableSegment(0).front();
+    }
+
+    /// @brief Последний элемент для изменения; отделяет последний сегмент
+    /// @exception std::out_of_range Если список пуст
+    T& back() {
+        checkNotEmpty();
+        return mutableSegment(mutableSpine().segments.size() - 1).back();
+    }
+
+    /**
+     * @brief Вставляет элемент, созданный из ```args```, перед ```pos```
+     * @param pos Позиция вставки
+     * @param args Аргументы конструктора элемента
+     * @return Итератор на вставленный элемент
+     */
+    template <typename... Args>
+    ConstIterator emplace(ConstIterator pos, Args&&... args) {
+        size_t offset = offsetOf(pos);
+        size_t index = pos.segment;
+        Spine& spine = mutableSpine();
+        if (spine.segments.empty()) {
+            spine.segments.push_back(std::make_shared<Segment>(_alloc));
+        }
+        else if (index == spine.segments.size()) {
+            --index;
+            offset = spine.segments[index]->size();
+        }
+        Segment& segment = mutableSegment(index);
+        segment.emplace(at(segment, offset), std::forward<Args>(args)...);
+        ++spine.size;
+        if (segment.size() > 2 * segmentSize) {
+            split(index);
+        }
+        return iteratorAt(index, offset);
+    }
+
+    ConstIterator insert(ConstIterator pos, const T& value) { return emplace(pos, value); }
+    ConstIterator insert(ConstIterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+    /**
+     * @brief Удаляет элемент в позиции ```pos```
+     * @param pos Позиция удаляемого элемента
+     * @return Итератор на следующий элемент
+     */
+    ConstIterator erase(ConstIterator pos) {
+        size_t offset = offsetOf(pos);
+        size_t index = pos.segment;
+        Spine& spine = mutableSpine();
+        Segment& segment = mutableSegment(index);
+        segment.erase(at(segment, offset));
+        --spine.size;
+        if (segment.empty()) {
+            spine.segments.erase(spine.segments.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+        return iteratorAt(index, offset);
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        emplace(cend(), std::forward<Args>(args)...);
+        return _spine->segments.back()->back();
+    }
+
+    template <typename... Args>
+    T& emplace_front(Args&&... args) {
+        emplace(cbegin(), std::forward<Args>(args)...);
+        return _spine->segments.front()->front();
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    /// @brief Удаляет первый элемент
+    /// @exception std::out_of_range Если список пуст
+    void pop_front() {
+        checkNotEmpty();
+        erase(cbegin());
+    }
+
+    /// @brief Удаляет последний элемент
+    /// @exception std::out_of_range Если список пуст
+    void pop_back() {
+        checkNotEmpty();
+        erase(std::prev(cend()));
+    }
+
+    /// @brief Удаляет все элементы; общие сегменты остаются у других копий
+    void clear() { _spine.reset(); }
+
+    /// @brief Обмен содержимым за O(1)
+    /// @param other Список для обмена
+    void swap(CowList& other) noexcept {
+        _spine.swap(other._spine);
+    }
+
+    /// @brief Сортировка слиянием; общие сегменты копируются, собственные - перевязываются
+    void sort() { sort(std::less<T>()); }
+
+    /// @brief Сортировка слиянием с компаратором
+    /// @param comp Компаратор
+    template <typename Compare>
+    void sort(Compare comp) {
+        if (size() < 2) {
+            return;
+        }
+        Segment all(_alloc);
+        bool ownSpine = isUnique(_spine);
+        for (SegmentPtr& segment : _spine->segments) {
+            if (ownSpine && isUnique(segment)) {
+                all.splice(all.cend(), *segment);
+            }
+            else {
+                all.insert(all.cend(), segment->cbegin(), segment->cend());
+            }
+        }
+        all.sort(comp);
+        auto spine = std::make_shared<Spine>();
+        spine->size = all.size();
+        while (!all.empty()) {
+            size_t count = std::min(segmentSize, all.size());
+            auto segment = std::make_shared<Segment>(_alloc);
+            segment->splice(segment->cend(), all, all.cbegin(), at(all, count), count);
+            spine->segments.push_back(std::move(segment));
+        }
+        _spine = std::move(spine);
+    }
+
+private:
+    /// @brief Единственный ли владелец у ```ptr```
+    /// @details Барьер нужен, чтобы чтения копии, отпустившей объект, завершились
+    ///     до того, как текущий поток начнёт менять его на месте
+    template <typename P>
+    static bool isUnique(const std::shared_ptr<P>& ptr) {
+        if (ptr.use_count() == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Итератор на элемент ```offset``` сегмента; идёт от ближнего конца
+    static SegmentIterator at(const Segment& segment, size_t offset) {
+        size_t size = segment.size();
+        return offset <= size / 2 ? segment.cbegin() + offset : segment.cend() - (size - offset);
+    }
+
+    /// @brief Номер элемента ```pos``` в его сегменте
+    size_t offsetOf(const ConstIterator& pos) const {
+        if (_spine == nullptr || pos.segment == _spine->segments.size()) {
+            return 0;
+        }
+        return static_cast<size_t>(std::distance(_spine->segments[pos.segment]->cbegin(), pos.it));
+    }
+
+    /// @brief Итератор на элемент ```offset``` сегмента ```index```; смещение может выходить за сегмент
+    ConstIterator iteratorAt(size_t index, size_t offset) const {
+        const auto& segments = _spine->segments;
+        while (index < segments.size() && offset >= segments[index]->size()) {
+            offset -= segments[index]->size();
+            ++index;
+        }
+        return ConstIterator(_spine.get(), index,
+                             index < segments.size() ? at(*segments[index], offset) : SegmentIterator());
+    }
+
+    void checkNotEmpty() const {
+        if (empty()) {
+            throw std::out_of_range("List is empty!");
+        }
+    }
+
+    /// @brief Оглавление только этого списка; общее копируется
+    Spine& mutableSpine() {
+        if (_spine == nullptr) {
+            _spine = std::make_shared<Spine>();
+        }
+        else if (!isUnique(_spine)) {
+            _spine = std::make_shared<Spine>(*_spine);
+        }
+        return *_spine;
+    }
+
+    /// @brief Сегмент ```index``` только этого списка; общий копируется. Оглавление уже должно быть своим
+    Segment& mutableSegment(size_t index) {
+        SegmentPtr& segment = _spine->segments[index];
+        if (!isUnique(segment)) {
+            segment = std::make_shared<Segment>(*segment, _alloc);
+        }
+        return *segment;
+    }
+
+    /// @brief Делит сегмент ```index``` пополам
+    void split(size_t index) {
+        Segment& segment = *_spine->segments[index];
+        size_t keep = segment.size() / 2;
+        size_t moved = segment.size() - keep;
+        auto tail = std::make_shared<Segment>(_alloc);
+        tail->splice(tail->cend(), segment, at(segment, keep), segment.cend(), moved);
+        _spine->segments.insert(_spine->segments.begin() + static_cast<std::ptrdiff_t>(index) + 1, std::move(tail));
+    }
+
+    /// @brief Добавляет элемент в конец, заполняя сегменты до ```segmentSize```
+    void appendFilled(const T& value) {
+        Spine& spine = mutableSpine();
+        if (spine.segments.empty() || spine.segments.back()->size() >= segmentSize) {
+            spine.segments.push_back(std::make_shared<Segment>(_alloc));
+        }
+        spine.segments.back()->push_back(value);
+        ++spine.size;
+    }
+
+    /// @brief Оглавление; ```nullptr``` у пустого списка
+    std::shared_ptr<Spine> _spine;
+
+    /// @brief Аллокатор новых сегментов
+    Alloc _alloc;
+};
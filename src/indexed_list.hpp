@@ -0,0 +1,1030 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "merge.hpp"
+
+/**
+ * @brief Двусвязный список с доступом к k-му элементу за O(log n)
+ * @details Поверх связей ```prevP```/```nextP``` поддерживается индексируемый skip list:
+ *      у части узлов есть связи верхних уровней, и каждая связь помнит, сколько
+ *      элементов она перешагивает. Поэтому ```at```, ```advance``` и ```index_of```
+ *      работают за ожидаемые O(log n), но и вставка с удалением стоят O(log n).
+ *      Кому позиционный доступ не нужен, выбирают ```List```: он за индекс не платит.
+ *      Итераторы остаются действительными, пока их элемент не удалён
+ * @tparam T Тип хранимых элементов
+ * @tparam Alloc Аллокатор элементов; перепривязывается к ```Node``` и ```Link```
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class IndexedList {
+protected:
+    struct Node;
+
+    /// @brief Связь верхнего уровня
+    struct Link {
+        /// @brief Следующий узел этого уровня; ```nullptr``` - конец списка
+        Node* next = nullptr;
+
+        /// @brief На сколько позиций связь сдвигает вперёд
+        size_t width = 0;
+    };
+
+    /// @brief Узел списка
+    struct Node {
+        /// @brief Указатель на предыдущий узел
+        Node* prevP = nullptr;
+
+        /// @brief Указатель на следующий узел
+        Node* nextP = nullptr;
+
+        /// @brief Связи уровней 1..```height```
+        Link* upper = nullptr;
+
+        /// @brief Количество верхних уровней узла
+        size_t height = 0;
+
+        union {
+            /// @brief Хранящиеся данные
+            T data;
+        };
+
+        Node() {}
+        ~Node() {}
+    };
+
+    /// @brief Наибольшее количество уровней вместе с нижним
+    static constexpr size_t maxLevel = 32;
+
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
+    using LinkAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Link>;
+    using LinkAllocTraits = std::allocator_traits<LinkAlloc>;
+    using ValueAllocTraits = std::allocator_traits<Alloc>;
+
+    /**
+     * @brief Выделяет узел случайной высоты и конструирует в нём элемент
+     * @param args Аргументы конструктора элемента
+     * @return Указатель на новый узел (ещё не связанный со списком)
+     */
+    template <typename... Args>
+    Node* createNode(Args&&... args);
+
+    /// @brief Разрушает элемент узла и освобождает узел
+    /// @param node Указатель на узел
+    void destroyNode(Node* node);
+
+    /// @brief Высота нового узла: уровень добавляется с вероятностью 1/4
+    /// @return Количество верхних уровней
+    size_t randomHeight();
+
+    /// @brief Связь уровня ```level``` (не меньше 1) узла или заголовка
+    /// @param node Узел; ```nullptr``` - заголовок списка
+    /// @param level Уровень
+    /// @return Ссылка на связь
+    Link& linkAt(Node* node, size_t level);
+
+    /**
+     * @brief Находит на каждом верхнем уровне последний узел перед позицией ```position```
+     * @param position Позиция, считая заголовок нулевой, а первый элемент - первой
+     * @param update Найденные узлы по уровням (```nullptr``` - заголовок)
+     * @param rank Позиции найденных узлов
+     */
+    void findPredecessors(size_t position, Node** update, size_t* rank) const;
+
+    /// @brief Позиция узла (заголовок - 0, первый элемент - 1, ```nullptr``` - ```_size + 1```)
+    /// @details Идёт к концу списка по самым высоким связям узлов
+    /// @param node Узел списка
+    /// @return Позиция узла
+    size_t positionOf(const Node* node) const;
+
+    /// @brief Узел в позиции ```position``` от 1 до ```_size + 1```
+    /// @param position Позиция; ```_size + 1``` даёт ```nullptr```
+    /// @return Указатель на узел
+    Node* nodeAt(size_t position) const;
+
+    /// @brief Встраивает готовый узел перед ```next``` и обновляет связи верхних уровней
+    /// @param next Узел, перед которым встраивается новый; ```nullptr``` - в конец
+    /// @param node Встраиваемый узел
+    void linkBefore(Node* next, Node* node);
+
+    /// @brief Вырезает узел из списка, не освобождая его
+    /// @param node Указатель на узел
+    void unlink(Node* node);
+
+    /// @brief Восстанавливает ```prevP``` и ```tail``` по цепочке ```nextP```, начиная с ```head```
+    void restoreBackLinks();
+
+    /// @brief Заново проставляет связи верхних уровней по порядку узлов за O(n)
+    /// @details Высоты узлов сохраняются
+    void rebuildIndex();
+
+    /// @brief Обмен содержимым без обмена аллокаторами
+    void swapThis(IndexedList& other);
+
+    /// @brief Аллокатор узлов
+    NodeAlloc _alloc;
+
+    /// @brief Указатель на первый узел списка
+    Node* head = nullptr;
+
+    /// @brief Указатель на последний узел списка
+    Node* tail = nullptr;
+
+    /// @brief Количество элементов списка
+    size_t _size = 0;
+
+    /// @brief Связи заголовка по уровням; нулевой не используется
+    Link _heads[maxLevel] = {};
+
+    /// @brief Количество используемых уровней вместе с нижним
+    size_t _levels = 1;
+
+    /// @brief Состояние генератора высот узлов
+    uint64_t _seed = 0x9e3779b97f4a7c15ull;
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Создаёт пустой список
+    IndexedList();
+
+    /// @brief Создаёт пустой список с заданным аллокатором
+    /// @param alloc Аллокатор
+    explicit IndexedList(const Alloc& alloc);
+
+    /**
+     * @brief Заполняет список ```count``` копиями ```value```
+     * @param count Количество элементов
+     * @param value Значение
+     * @param alloc Аллокатор
+     */
+    IndexedList(size_t count, const T& value, const Alloc& alloc = Alloc());
+
+    /**
+     * @brief Заполняет список значениями из ```std::initializer_list<T>```
+     * @param initList Список инициализации
+     * @param alloc Аллокатор
+     */
+    IndexedList(std::initializer_list<T> initList, const Alloc& alloc = Alloc());
+
+    /// @brief Деструктор
+    ~IndexedList();
+
+    /// @brief Конструктор копирования
+    /// @param other Копируемый список
+    IndexedList(const IndexedList& other);
+
+    /// @brief Конструктор перемещения
+    /// @param other Перемещаемый список
+    IndexedList(IndexedList&& other) noexcept;
+
+    /// @brief Оператор копирующего присваивания
+    /// @param other Копируемый список
+    /// @return Ссылка на текущий список
+    IndexedList& operator=(const IndexedList& other);
+
+    /// @brief Оператор перемещающего присваивания
+    /// @details Если аллокаторы не равны и не распространяются, элементы перемещаются поштучно
+    /// @param other Перемещаемый список
+    /// @return Ссылка на текущий список
+    IndexedList& operator=(IndexedList&& other);
+
+    /// @brief Возвращает копию аллокатора списка
+    /// @return Аллокатор элементов
+    Alloc get_allocator() const;
+
+    /**
+     * @brief Двунаправленный итератор списка
+     * @details ```operator+``` и ```operator-``` сдвигают итератор за O(log n)
+     * @tparam IsConst ```true``` для итератора на константные элементы
+     */
+    template <bool IsConst>
+    struct BasicIterator {
+        friend class IndexedList;
+        template <bool> friend struct BasicIterator;
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        /// @brief Создаёт итератор, не связанный ни с одним списком
+        BasicIterator() = default;
+
+        /// @brief Конструирование на основе узла
+        /// @param node Указатель на узел
+        /// @param owner Список, которому принадлежит узел
+        explicit BasicIterator(Node* node, const IndexedList* owner = nullptr) : node(node), owner(owner) {}
+
+        /// @brief Преобразование итератора в константный
+        /// @param other Неконстантный итератор
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) : node(other.node), owner(other.owner) {}
+
+        /// @brief Сдвиг на ```shift``` элементов вперёд за O(log n)
+        /// @param shift На сколько элементов сдвинуть итератор
+        /// @return Итератор на элемент в позиции ```позиция текущего + shift```
+        /// @exception std::out_of_range При попытке выйти за пределы списка
+        BasicIterator operator+(size_t shift) const {
+            return BasicIterator(owner->advance(*this, static_cast<difference_type>(shift)).node, owner);
+        }
+
+        /// @brief Сдвиг на ```shift``` элементов назад за O(log n)
+        /// @param shift На сколько элементов сдвинуть итератор
+        /// @return Итератор на элемент в позиции ```позиция текущего - shift```
+        /// @exception std::out_of_range При попытке выйти за пределы списка
+        BasicIterator operator-(size_t shift) const {
+            return BasicIterator(owner->advance(*this, -static_cast<difference_type>(shift)).node, owner);
+        }
+
+        /// @brief Пре-инкрементный сдвиг на следующий элемент
+        /// @return Итератор на следующий элемент
+        BasicIterator& operator++() {
+            node = node->nextP;
+            return *this;
+        }
+
+        /// @brief Пост-инкрементный сдвиг на следующий элемент
+        /// @return Итератор до сдвига
+        BasicIterator operator++(int) {
+            BasicIterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        /// @brief Пре-декрементный сдвиг на предыдущий элемент; от ```end()``` - к последнему
+        /// @return Итератор на предыдущий элемент
+        BasicIterator& operator--() {
+            node = node != nullptr ? node->prevP : owner->tail;
+            return *this;
+        }
+
+        /// @brief Пост-декрементный сдвиг на предыдущий элемент
+        /// @return Итератор до сдвига
+        BasicIterator operator--(int) {
+            BasicIterator old = *this;
+            --(*this);
+            return old;
+        }
+
+        /// @brief Сравнение двух итераторов
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator==(const BasicIterator<OtherConst>& other) const { return node == other.node; }
+
+        /// @brief Проверка на неравенство двух итераторов
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator!=(const BasicIterator<OtherConst>& other) const { return node != other.node; }
+
+        /// @brief Доступ к элементу
+        /// @return Ссылка на элемент
+        reference operator*() const { return node->data; }
+
+        /// @brief Доступ к членам элемента
+        /// @return Указатель на элемент
+        pointer operator->() const { return std::addressof(node->data); }
+
+    protected:
+        /// @brief Текущий узел
+        Node* node = nullptr;
+
+        /// @brief Список, из которого получен итератор
+        const IndexedList* owner = nullptr;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    /// @brief Поэлементное сравнение двух списков
+    /// @param other Сравниваемый список
+    /// @return Результат сравнения
+    bool operator==(const IndexedList& other) const;
+
+    /// @brief Поэлементная проверка на неравенство двух списков
+    /// @param other Сравниваемый список
+    /// @return Результат сравнения
+    bool operator!=(const IndexedList& other) const;
+
+    /// @brief Доступ к элементу по номеру за O(log n)
+    /// @param index Номер элемента, начиная с 0
+    /// @return Ссылка на элемент
+    /// @exception std::out_of_range Если ```index``` не меньше размера списка
+    T& at(size_t index);
+
+    /// @copydoc at(size_t)
+    const T& at(size_t index) const;
+
+    /// @brief Номер элемента, на который указывает итератор, за O(log n)
+    /// @param it Итератор этого списка
+    /// @return Номер элемента; для ```end()``` - размер списка
+    size_t index_of(ConstIterator it) const;
+
+    /// @brief Сдвигает итератор на ```shift``` позиций за O(log n)
+    /// @param it Итератор этого списка
+    /// @param shift Сдвиг; отрицательный - назад
+    /// @return Итератор на элемент в позиции ```index_of(it) + shift``` (или ```end()```)
+    /// @exception std::out_of_range При попытке выйти за пределы списка
+    Iterator advance(ConstIterator it, difference_type shift);
+
+    /// @copydoc advance(ConstIterator, difference_type)
+    ConstIterator advance(ConstIterator it, difference_type shift) const;
+
+    /// @brief Доступ к первому элементу списка
+    /// @return Первый элемент
+    T& front();
+
+    /// @copydoc front()
+    const T& front() const;
+
+    /// @brief Доступ к последнему элементу списка
+    /// @return Последний элемент
+    T& back();
+
+    /// @copydoc back()
+    const T& back() const;
+
+    /// @brief Добавление в начало списка
+    /// @param data Добавляемые данные
+    void push_front(const T& data);
+
+    /// @brief Добавление в начало списка перемещением
+    /// @param data Перемещаемые данные
+    void push_front(T&& data);
+
+    /// @brief Добавление в конец списка
+    /// @param data Добавляемые данные
+    void push_back(const T& data);
+
+    /// @brief Добавление в конец списка перемещением
+    /// @param data Перемещаемые данные
+    void push_back(T&& data);
+
+    /// @brief Конструирует элемент в начале списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_front(Args&&... args);
+
+    /// @brief Конструирует элемент в конце списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+
+    /// @brief Удаление из начала списка
+    void pop_front();
+
+    /// @brief Удаление из конца списка
+    void pop_back();
+
+    /// @brief Вставка элемента в позицию за O(log n)
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param value Вставляемое значение
+    /// @return Итератор на вставленный элемент
+    Iterator insert(ConstIterator pos, const T& value);
+
+    /// @brief Вставка элемента в позицию перемещением
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param value Перемещаемое значение
+    /// @return Итератор на вставленный элемент
+    Iterator insert(ConstIterator pos, T&& value);
+
+    /// @brief Конструирует элемент перед ```pos```
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param args Аргументы конструктора элемента
+    /// @return Итератор на созданный элемент
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args);
+
+    /// @brief Удаление элемента в позиции за O(log n)
+    /// @param pos Позиция удаляемого элемента
+    /// @return Итератор на следующий элемент
+    Iterator erase(ConstIterator pos);
+
+    /// @brief Удаление элементов в диапазоне [```first```, ```last```)
+    /// @param first Первый удаляемый элемент
+    /// @param last Элемент, до которого идёт удаление
+    /// @return Итератор на элемент ```last```
+    Iterator erase(ConstIterator first, ConstIterator last);
+
+    /// @brief Сортирует элементы списка
+    void sort();
+
+    /// @brief Устойчиво сортирует элементы списка с помощью компаратора
+    /// @details Узлы перевязываются слиянием, как в ```List```, затем индекс
+    ///     перестраивается за один проход
+    /// @param comp Компаратор: ```true```, если первый элемент строго меньше второго
+    template <typename Compare>
+    void sort(Compare comp);
+
+    /// @brief Оборачивание списка (элементы в обратном порядке)
+    void reverse();
+
+    /// @brief Удаляет все элементы списка
+    void clear();
+
+    /// @brief Проверка на наличие элементов в списке
+    /// @return ```true```, если список пустой
+    bool empty() const;
+
+    /// @brief Возвращает размер списка
+    /// @return Количество элементов списка
+    size_t size() const;
+
+    Iterator begin();
+    ConstIterator begin() const;
+    Iterator end();
+    ConstIterator end() const;
+    ConstIterator cbegin() const;
+    ConstIterator cend() const;
+    reverse_iterator rbegin();
+    const_reverse_iterator rbegin() const;
+    reverse_iterator rend();
+    const_reverse_iterator rend() const;
+};
+
+template <typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList() : IndexedList(Alloc()) {}
+
+template <typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList(const Alloc& alloc) : _alloc(alloc) {}
+
+template <typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList(size_t count, const T& value, const Alloc& alloc) : IndexedList(alloc) {
+    for (size_t i = 0; i < count; ++i) {
+        push_back(value);
+    }
+}
+
+template <typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList(std::initializer_list<T> initList, const Alloc& alloc) : IndexedList(alloc) {
+    for (const T& elem : initList) {
+        push_back(elem);
+    }
+}
+
+template <typename T, typename Alloc>
+IndexedList<T, Alloc>::~IndexedList() {
+    clear();
+}
+
+template <typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList(const IndexedList& other)
+    : IndexedList(ValueAllocTraits::select_on_container_copy_construction(other.get_allocator())) {
+    for (const T& elem : other) {
+        push_back(elem);
+    }
+}
+
+template <typename T, typename Alloc>
+IndexedList<T, Alloc>::IndexedList(IndexedList&& other) noexcept : _alloc(std::move(other._alloc)) {
+    swapThis(other);
+}
+
+template <typename T, typename Alloc>
+IndexedList<T, Alloc>& IndexedList<T, Alloc>::operator=(const IndexedList& other) {
+    if (this != &other) {
+        IndexedList tmp(other);
+        *this = std::move(tmp);
+    }
+    return *this;
+}
+
+template <typename T, typename Alloc>
+IndexedList<T, Alloc>& IndexedList<T, Alloc>::operator=(IndexedList&& other) {
+    if (this == &other) {
+        return *this;
+    }
+    clear();
+    if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::value) {
+        _alloc = std::move(other._alloc);
+    }
+    else if (_alloc != other._alloc) {
+        for (T& elem : other) {
+            push_back(std::move(elem));
+        }
+        other.clear();
+        return *this;
+    }
+    swapThis(other);
+    return *this;
+}
+
+template <typename T, typename Alloc>
+Alloc IndexedList<T, Alloc>::get_allocator() const {
+    return Alloc(_alloc);
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::swapThis(IndexedList& other) {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(_size, other._size);
+    std::swap(_heads, other._heads);
+    std::swap(_levels, other._levels);
+}
+
+template <typename T, typename Alloc>
+size_t IndexedList<T, Alloc>::randomHeight() {
+    _seed ^= _seed << 13;
+    _seed ^= _seed >> 7;
+    _seed ^= _seed << 17;
+    uint64_t bits = _seed;
+    size_t height = 0;
+    while (height < maxLevel - 1 && (bits & 3) == 0) {
+        ++height;
+        bits >>= 2;
+    }
+    return height;
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+typename IndexedList<T, Alloc>::Node* IndexedList<T, Alloc>::createNode(Args&&... args) {
+    size_t height = randomHeight();
+    Node* node = NodeAllocTraits::allocate(_alloc, 1);
+    ::new (static_cast<void*>(node)) Node();
+    LinkAlloc linkAlloc(_alloc);
+    try {
+        if (height > 0) {
+            node->upper = LinkAllocTraits::allocate(linkAlloc, height);
+            std::uninitialized_value_construct_n(node->upper, height);
+            node->height = height;
+        }
+        Alloc valueAlloc(_alloc);
+        ValueAllocTraits::construct(valueAlloc, std::addressof(node->data), std::forward<Args>(args)...);
+    }
+    catch (...) {
+        if (node->upper != nullptr) {
+            LinkAllocTraits::deallocate(linkAlloc, node->upper, height);
+        }
+        node->~Node();
+        NodeAllocTraits::deallocate(_alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::destroyNode(Node* node) {
+    Alloc valueAlloc(_alloc);
+    ValueAllocTraits::destroy(valueAlloc, std::addressof(node->data));
+    if (node->upper != nullptr) {
+        LinkAlloc linkAlloc(_alloc);
+        LinkAllocTraits::deallocate(linkAlloc, node->upper, node->height);
+    }
+    node->~Node();
+    NodeAllocTraits::deallocate(_alloc, node, 1);
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::Link& IndexedList<T, Alloc>::linkAt(Node* node, size_t level) {
+    return node != nullptr ? node->upper[level - 1] : _heads[level];
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::findPredecessors(size_t position, Node** update, size_t* rank) const {
+    Node* curr = nullptr;
+    size_t pos = 0;
+    for (size_t level = _levels - 1; level > 0; --level) {
+        const Link* link = curr != nullptr ? &curr->upper[level - 1] : &_heads[level];
+        while (link->next != nullptr && pos + link->width < position) {
+            pos += link->width;
+            curr = link->next;
+            link = &curr->upper[level - 1];
+        }
+        update[level] = curr;
+        rank[level] = pos;
+    }
+}
+
+template <typename T, typename Alloc>
+size_t IndexedList<T, Alloc>::positionOf(const Node* node) const {
+    size_t distance = 0;
+    while (node != nullptr) {
+        if (node->height > 0) {
+            const Link& link = node->upper[node->height - 1];
+            distance += link.width;
+            node = link.next;
+        }
+        else {
+            ++distance;
+            node = node->nextP;
+        }
+    }
+    return _size + 1 - distance;
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::Node* IndexedList<T, Alloc>::nodeAt(size_t position) const {
+    Node* curr = nullptr;
+    size_t pos = 0;
+    for (size_t level = _levels - 1; level > 0; --level) {
+        const Link* link = curr != nullptr ? &curr->upper[level - 1] : &_heads[level];
+        while (link->next != nullptr && pos + link->width <= position) {
+            pos += link->width;
+            curr = link->next;
+            link = &curr->upper[level - 1];
+        }
+    }
+    for (; pos < position; ++pos) {
+        curr = curr != nullptr ? curr->nextP : head;
+    }
+    return curr;
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::linkBefore(Node* next, Node* node) {
+    size_t position = positionOf(next);
+    for (; _levels <= node->height; ++_levels) {
+        _heads[_levels] = Link{nullptr, _size + 1};
+    }
+    Node* update[maxLevel];
+    size_t rank[maxLevel];
+    findPredecessors(position, update, rank);
+
+    for (size_t level = 1; level < _levels; ++level) {
+        Link& link = linkAt(update[level], level);
+        if (level <= node->height) {
+            // цель связи сдвигается на одну позицию вправо
+            node->upper[level - 1] = Link{link.next, rank[level] + link.width + 1 - position};
+            link = Link{node, position - rank[level]};
+        }
+        else {
+            ++link.width;
+        }
+    }
+
+    Node* prev = next != nullptr ? next->prevP : tail;
+    node->prevP = prev;
+    node->nextP = next;
+    if (prev != nullptr) {
+        prev->nextP = node;
+    }
+    else {
+        head = node;
+    }
+    if (next != nullptr) {
+        next->prevP = node;
+    }
+    else {
+        tail = node;
+    }
+    ++_size;
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::unlink(Node* node) {
+    Node* update[maxLevel];
+    size_t rank[maxLevel];
+    findPredecessors(positionOf(node), update, rank);
+
+    for (size_t level = 1; level < _levels; ++level) {
+        Link& link = linkAt(update[level], level);
+        if (level <= node->height) {
+            link = Link{node->upper[level - 1].next, link.width + node->upper[level - 1].width - 1};
+        }
+        else {
+            --link.width;
+        }
+    }
+    while (_levels > 1 && _heads[_levels - 1].next == nullptr) {
+        --_levels;
+    }
+
+    if (node->prevP != nullptr) {
+        node->prevP->nextP = node->nextP;
+    }
+    else {
+        head = node->nextP;
+    }
+    if (node->nextP != nullptr) {
+        node->nextP->prevP = node->prevP;
+    }
+    else {
+        tail = node->prevP;
+    }
+    --_size;
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::restoreBackLinks() {
+    Node* prev = nullptr;
+    for (Node* node = head; node != nullptr; node = node->nextP) {
+        node->prevP = prev;
+        prev = node;
+    }
+    tail = prev;
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::rebuildIndex() {
+    Node* last[maxLevel] = {};
+    size_t lastPos[maxLevel] = {};
+    size_t pos = 0;
+    for (Node* node = head; node != nullptr; node = node->nextP) {
+        ++pos;
+        for (size_t level = 1; level <= node->height; ++level) {
+            linkAt(last[level], level) = Link{node, pos - lastPos[level]};
+            last[level] = node;
+            lastPos[level] = pos;
+        }
+    }
+    for (size_t level = 1; level < _levels; ++level) {
+        linkAt(last[level], level) = Link{nullptr, _size + 1 - lastPos[level]};
+    }
+}
+
+template <typename T, typename Alloc>
+bool IndexedList<T, Alloc>::operator==(const IndexedList& other) const {
+    return _size == other._size && std::equal(begin(), end(), other.begin());
+}
+
+template <typename T, typename Alloc>
+bool IndexedList<T, Alloc>::operator!=(const IndexedList& other) const {
+    return !(*this == other);
+}
+
+template <typename T, typename Alloc>
+T& IndexedList<T, Alloc>::at(size_t index) {
+    if (index >= _size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return nodeAt(index + 1)->data;
+}
+
+template <typename T, typename Alloc>
+const T& IndexedList<T, Alloc>::at(size_t index) const {
+    if (index >= _size) {
+        throw std::out_of_range("Index out of range");
+    }
+    return nodeAt(index + 1)->data;
+}
+
+template <typename T, typename Alloc>
+size_t IndexedList<T, Alloc>::index_of(ConstIterator it) const {
+    return positionOf(it.node) - 1;
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::Iterator IndexedList<T, Alloc>::advance(ConstIterator it, difference_type shift) {
+    return Iterator(std::as_const(*this).advance(it, shift).node, this);
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::ConstIterator
+IndexedList<T, Alloc>::advance(ConstIterator it, difference_type shift) const {
+    if (shift == 0) {
+        return it;
+    }
+    difference_type target = static_cast<difference_type>(index_of(it)) + shift;
+    if (target < 0 || target > static_cast<difference_type>(_size)) {
+        throw std::out_of_range("Advancing out of range");
+    }
+    return ConstIterator(nodeAt(static_cast<size_t>(target) + 1), this);
+}
+
+template <typename T, typename Alloc>
+T& IndexedList<T, Alloc>::front() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return head->data;
+}
+
+template <typename T, typename Alloc>
+const T& IndexedList<T, Alloc>::front() const {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return head->data;
+}
+
+template <typename T, typename Alloc>
+T& IndexedList<T, Alloc>::back() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return tail->data;
+}
+
+template <typename T, typename Alloc>
+const T& IndexedList<T, Alloc>::back() const {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return tail->data;
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::push_front(T&& data) {
+    emplace_front(std::move(data));
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+T& IndexedList<T, Alloc>::emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+T& IndexedList<T, Alloc>::emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(begin());
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(ConstIterator(tail, this));
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::Iterator IndexedList<T, Alloc>::insert(ConstIterator pos, const T& value) {
+    return emplace(pos, value);
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::Iterator IndexedList<T, Alloc>::insert(ConstIterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+typename IndexedList<T, Alloc>::Iterator IndexedList<T, Alloc>::emplace(ConstIterator pos, Args&&... args) {
+    Node* node = createNode(std::forward<Args>(args)...);
+    linkBefore(pos.node, node);
+    return Iterator(node, this);
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::Iterator IndexedList<T, Alloc>::erase(ConstIterator pos) {
+    if (empty()) {
+        throw std::out_of_range("Trying to erase in empty list!");
+    }
+    if (pos.node == nullptr) {
+        throw std::out_of_range("Invalid erasing");
+    }
+    Node* next = pos.node->nextP;
+    unlink(pos.node);
+    destroyNode(pos.node);
+    return Iterator(next, this);
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::Iterator IndexedList<T, Alloc>::erase(ConstIterator first, ConstIterator last) {
+    while (first != last) {
+        first = erase(first);
+    }
+    return Iterator(last.node, this);
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::sort() {
+    sort(std::less<T>());
+}
+
+template <typename T, typename Alloc>
+template <typename Compare>
+void IndexedList<T, Alloc>::sort(Compare comp) {
+    if (_size < 2) {
+        return;
+    }
+    auto nodeComp = [&comp](const Node* left, const Node* right) {
+        return comp(left->data, right->data);
+    };
+    try {
+        sortNodes(head, nodeComp);
+    }
+    catch (...) {
+        restoreBackLinks();
+        rebuildIndex();
+        throw;
+    }
+    restoreBackLinks();
+    rebuildIndex();
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::reverse() {
+    for (Node* node = head; node != nullptr; node = node->prevP) {
+        std::swap(node->prevP, node->nextP);
+    }
+    std::swap(head, tail);
+    rebuildIndex();
+}
+
+template <typename T, typename Alloc>
+void IndexedList<T, Alloc>::clear() {
+    Node* node = head;
+    while (node != nullptr) {
+        Node* next = node->nextP;
+        destroyNode(node);
+        node = next;
+    }
+    head = tail = nullptr;
+    _size = 0;
+    _levels = 1;
+}
+
+template <typename T, typename Alloc>
+bool IndexedList<T, Alloc>::empty() const {
+    return _size == 0;
+}
+
+template <typename T, typename Alloc>
+size_t IndexedList<T, Alloc>::size() const {
+    return _size;
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::Iterator IndexedList<T, Alloc>::begin() {
+    return Iterator(head, this);
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::ConstIterator IndexedList<T, Alloc>::begin() const {
+    return ConstIterator(head, this);
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::Iterator IndexedList<T, Alloc>::end() {
+    return Iterator(nullptr, this);
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::ConstIterator IndexedList<T, Alloc>::end() const {
+    return ConstIterator(nullptr, this);
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::ConstIterator IndexedList<T, Alloc>::cbegin() const {
+    return begin();
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::ConstIterator IndexedList<T, Alloc>::cend() const {
+    return end();
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::reverse_iterator IndexedList<T, Alloc>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::const_reverse_iterator IndexedList<T, Alloc>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::reverse_iterator IndexedList<T, Alloc>::rend() {
+    return reverse_iterator(begin());
+}
+
+template <typename T, typename Alloc>
+typename IndexedList<T, Alloc>::const_reverse_iterator IndexedList<T, Alloc>::rend() const {
+    return const_reverse_iterator(begin());
+}
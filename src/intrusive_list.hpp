@@ -0,0 +1,683 @@
+#pragma once
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "merge.hpp"
+
+/**
+ * @brief Звено интрузивного списка, встраиваемое в пользовательский объект
+ * @details Копирование объекта не копирует связи: копия звена всегда не связана
+ */
+struct ListHook {
+    /// @brief Указатель на предыдущее звено
+    ListHook* prevP = nullptr;
+
+    /// @brief Указатель на следующее звено
+    ListHook* nextP = nullptr;
+
+    ListHook() = default;
+
+    /// @brief Копия звена не связана ни с каким списком
+    ListHook(const ListHook&) {}
+
+    /// @brief Присваивание объекта не меняет его связи
+    /// @return Ссылка на текущее звено
+    ListHook& operator=(const ListHook&) { return *this; }
+
+    /// @brief Проверка, состоит ли объект в списке
+    /// @return ```true```, если звено связано
+    bool is_linked() const { return nextP != nullptr; }
+};
+
+/**
+ * @brief Интрузивный двусвязный список: связи хранятся в самих объектах
+ * @details Список не владеет объектами и никогда не выделяет память: вставка
+ *      только связывает звено ```T::*Member```, удаление только развязывает его.
+ *      Объект может состоять в нескольких списках одновременно, если у него
+ *      несколько звеньев. Звенья замкнуты в кольцо через звено-ограничитель
+ *      внутри списка, поэтому ```--end()``` и удаление по ссылке работают за O(1).
+ *      Объект должен жить дольше, чем он состоит в списке
+ * @tparam T Тип объектов; звено не может лежать в виртуальном базовом классе
+ * @tparam Member Звено объекта, используемое этим списком
+ */
+template <typename T, ListHook T::*Member>
+class IntrusiveList {
+protected:
+    /**
+     * @brief Смещение звена ```Member``` от начала ```T```
+     * @details Берётся из самого указателя на член: в Itanium C++ ABI (GCC, Clang) он
+     *      хранит смещение члена в байтах, у MSVC для классов без виртуального
+     *      наследования - 32-битное смещение. Поэтому подходит любой ```T```, не только
+     *      со стандартной раскладкой; после оптимизации это константа
+     * @return Смещение в байтах
+     */
+    static std::ptrdiff_t hookOffset();
+
+    /// @brief Состоит ли звено в этом списке; проход за O(n), только для проверок
+    /// @param hook Звено
+    /// @return ```true```, если ```hook``` связан с кольцом этого списка
+    bool contains(const ListHook* hook) const;
+
+    /**
+     * @brief Получение объекта по его звену
+     * @param hook Звено объекта
+     * @return Указатель на объект
+     */
+    static T* fromHook(ListHook* hook);
+
+    /// @copydoc fromHook(ListHook*)
+    static const T* fromHook(const ListHook* hook);
+
+    /**
+     * @brief Звено объекта
+     * @param value Объект
+     * @return Указатель на звено
+     */
+    static ListHook* toHook(T& value);
+
+    /// @brief Встраивает цепочку звеньев [```first```, ```last```] перед ```next```
+    void linkBefore(ListHook* next, ListHook* first, ListHook* last, size_t count);
+
+    /// @brief Вырезает цепочку звеньев [```first```, ```last```], не сбрасывая их связи
+    void unlink(ListHook* first, ListHook* last, size_t count);
+
+    /// @brief Забирает все звенья ```other```; текущий список должен быть пуст
+    void steal(IntrusiveList& other);
+
+    /// @brief Звено-ограничитель: ```nextP``` - первое звено, ```prevP``` - последнее
+    ListHook root;
+
+    /// @brief Количество объектов в списке
+    size_t _size = 0;
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    /// @brief Создаёт пустой список
+    IntrusiveList();
+
+    /// @brief Развязывает все объекты списка
+    ~IntrusiveList();
+
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    /// @brief Конструктор перемещения: объекты переходят в новый список
+    /// @param other Перемещаемый список
+    IntrusiveList(IntrusiveList&& other) noexcept;
+
+    /// @brief Перемещающее присваивание: текущие объекты развязываются
+    /// @param other Перемещаемый список
+    /// @return Ссылка на текущий список
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept;
+
+    /**
+     * @brief Двунаправленный итератор по объектам списка
+     * @tparam IsConst ```true``` для итератора на константные объекты
+     */
+    template <bool IsConst>
+    struct BasicIterator {
+        friend class IntrusiveList;
+        template <bool> friend struct BasicIterator;
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        /// @brief Создаёт итератор, не связанный ни с одним списком
+        BasicIterator() = default;
+
+        /// @brief Конструирование на основе звена
+        /// @param hook Звено объекта или ограничитель списка
+        explicit BasicIterator(ListHook* hook) : hook(hook) {}
+
+        /// @brief Преобразование итератора в константный
+        /// @param other Неконстантный итератор
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) : hook(other.hook) {}
+
+        /// @brief Пре-инкрементный сдвиг на следующий объект
+        /// @return Итератор на следующий объект
+        BasicIterator& operator++() {
+            hook = hook->nextP;
+            return *this;
+        }
+
+        /// @brief Пост-инкрементный сдвиг на следующий объект
+        /// @return Итератор до сдвига
+        BasicIterator operator++(int) {
+            BasicIterator old = *this;
+            hook = hook->nextP;
+            return old;
+        }
+
+        /// @brief Пре-декрементный сдвиг на предыдущий объект
+        /// @return Итератор на предыдущий объект
+        BasicIterator& operator--() {
+            hook = hook->prevP;
+            return *this;
+        }
+
+        /// @brief Пост-декрементный сдвиг на предыдущий объект
+        /// @return Итератор до сдвига
+        BasicIterator operator--(int) {
+            BasicIterator old = *this;
+            hook = hook->prevP;
+            return old;
+        }
+
+        /// @brief Сравнение двух итераторов
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator==(const BasicIterator<OtherConst>& other) const { return hook == other.hook; }
+
+        /// @brief Проверка на неравенство двух итераторов
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator!=(const BasicIterator<OtherConst>& other) const { return hook != other.hook; }
+
+        /// @brief Доступ к объекту
+        /// @return Ссылка на объект
+        reference operator*() const { return *fromHook(hook); }
+
+        /// @brief Доступ к членам объекта
+        /// @return Указатель на объект
+        pointer operator->() const { return fromHook(hook); }
+
+    protected:
+        /// @brief Текущее звено
+        ListHook* hook = nullptr;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    /// @brief Доступ к первому объекту
+    /// @return Первый объект
+    T& front();
+
+    /// @copydoc front()
+    const T& front() const;
+
+    /// @brief Доступ к последнему объекту
+    /// @return Последний объект
+    T& back();
+
+    /// @copydoc back()
+    const T& back() const;
+
+    /// @brief Добавление объекта в начало списка
+    /// @param value Объект; не должен состоять в списке по этому звену
+    void push_front(T& value);
+
+    /// @brief Добавление объекта в конец списка
+    /// @param value Объект; не должен состоять в списке по этому звену
+    void push_back(T& value);
+
+    /// @brief Развязывает первый объект
+    void pop_front();
+
+    /// @brief Развязывает последний объект
+    void pop_back();
+
+    /// @brief Вставка объекта перед ```pos```
+    /// @param pos Позиция для вставки
+    /// @param value Объект; не должен состоять в списке по этому звену
+    /// @return Итератор на вставленный объект
+    Iterator insert(ConstIterator pos, T& value);
+
+    /// @brief Развязывает объект в позиции ```pos```
+    /// @param pos Позиция удаляемого объекта
+    /// @return Итератор на следующий объект
+    Iterator erase(ConstIterator pos);
+
+    /// @brief Развязывает объекты в диапазоне [```first```, ```last```)
+    /// @param first Первый удаляемый объект
+    /// @param last Объект, до которого идёт удаление
+    /// @return Итератор на ```last```
+    Iterator erase(ConstIterator first, ConstIterator last);
+
+    /// @brief Развязывает объект за O(1), зная только ссылку на него
+    /// @details Принадлежность объекта списку не проверяется (в отладочной сборке -
+    ///     ```assert``` за O(n)): объект другого списка с тем же звеном был бы
+    ///     развязан там, а размеры обоих списков стали бы неверными
+    /// @param value Объект этого списка; должен состоять именно в нём
+    void erase(T& value);
+
+    /// @brief Итератор на объект, который состоит в этом списке
+    /// @param value Объект
+    /// @return Итератор на ```value```
+    Iterator iterator_to(T& value);
+
+    /// @copydoc iterator_to(T&)
+    ConstIterator iterator_to(const T& value) const;
+
+    /// @brief Переносит все объекты ```other``` перед ```pos```
+    /// @param pos Позиция, перед которой вставляются объекты
+    /// @param other Список-источник (не должен совпадать с текущим)
+    void splice(ConstIterator pos, IntrusiveList& other);
+
+    /// @brief Переносит объект ```it``` из ```other``` перед ```pos```
+    /// @param pos Позиция, перед которой вставляется объект
+    /// @param other Список-источник (может совпадать с текущим)
+    /// @param it Переносимый объект
+    void splice(ConstIterator pos, IntrusiveList& other, ConstIterator it);
+
+    /// @brief Переносит объекты [```first```, ```last```) из ```other``` перед ```pos```
+    /// @details Для подсчёта размера диапазон проходится, если ```other``` - другой список
+    /// @param pos Позиция, перед которой вставляются объекты (не внутри диапазона)
+    /// @param other Список-источник (может совпадать с текущим)
+    /// @param first Первый переносимый объект
+    /// @param last Объект, до которого идёт перенос
+    void splice(ConstIterator pos, IntrusiveList& other, ConstIterator first, ConstIterator last);
+
+    /// @brief Переносит объекты [```first```, ```last```) известной длины за O(1)
+    /// @param pos Позиция, перед которой вставляются объекты (не внутри диапазона)
+    /// @param other Список-источник (может совпадать с текущим)
+    /// @param first Первый переносимый объект
+    /// @param last Объект, до которого идёт перенос
+    /// @param count Количество объектов в диапазоне; должно быть точным
+    void splice(ConstIterator pos, IntrusiveList& other, ConstIterator first, ConstIterator last, size_t count);
+
+    /// @brief Оборачивание списка (объекты в обратном порядке)
+    void reverse();
+
+    /// @brief Устойчивая сортировка перевязкой звеньев
+    void sort();
+
+    /// @brief Устойчивая сортировка перевязкой звеньев с компаратором
+    /// @param comp Компаратор: ```true```, если первый объект строго меньше второго
+    template <typename Compare>
+    void sort(Compare comp);
+
+    /// @brief Развязывает все объекты
+    void clear();
+
+    /// @brief Проверка на наличие объектов
+    /// @return ```true```, если список пустой
+    bool empty() const;
+
+    /// @brief Количество объектов
+    /// @return Размер списка
+    size_t size() const;
+
+    Iterator begin();
+    ConstIterator begin() const;
+    Iterator end();
+    ConstIterator end() const;
+    ConstIterator cbegin() const;
+    ConstIterator cend() const;
+    reverse_iterator rbegin();
+    const_reverse_iterator rbegin() const;
+    reverse_iterator rend();
+    const_reverse_iterator rend() const;
+};
+
+template <typename T, ListHook T::*Member>
+std::ptrdiff_t IntrusiveList<T, Member>::hookOffset() {
+    using Offset = std::conditional_t<sizeof(Member) == sizeof(std::ptrdiff_t), std::ptrdiff_t, std::int32_t>;
+    static_assert(sizeof(Member) == sizeof(Offset), "Unsupported pointer-to-member representation");
+    return static_cast<std::ptrdiff_t>(std::bit_cast<Offset>(Member));
+}
+
+template <typename T, ListHook T::*Member>
+bool IntrusiveList<T, Member>::contains(const ListHook* hook) const {
+    for (const ListHook* current = root.nextP; current != &root; current = current->nextP) {
+        if (current == hook) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T, ListHook T::*Member>
+T* IntrusiveList<T, Member>::fromHook(ListHook* hook) {
+    return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - hookOffset());
+}
+
+template <typename T, ListHook T::*Member>
+const T* IntrusiveList<T, Member>::fromHook(const ListHook* hook) {
+    return fromHook(const_cast<ListHook*>(hook));
+}
+
+template <typename T, ListHook T::*Member>
+ListHook* IntrusiveList<T, Member>::toHook(T& value) {
+    return &(value.*Member);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::linkBefore(ListHook* next, ListHook* first, ListHook* last, size_t count) {
+    ListHook* prev = next->prevP;
+    first->prevP = prev;
+    last->nextP = next;
+    prev->nextP = first;
+    next->prevP = last;
+    _size += count;
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::unlink(ListHook* first, ListHook* last, size_t count) {
+    first->prevP->nextP = last->nextP;
+    last->nextP->prevP = first->prevP;
+    _size -= count;
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::steal(IntrusiveList& other) {
+    if (other.empty()) {
+        return;
+    }
+    ListHook* first = other.root.nextP;
+    ListHook* last = other.root.prevP;
+    size_t count = other._size;
+    other.unlink(first, last, count);
+    linkBefore(&root, first, last, count);
+}
+
+template <typename T, ListHook T::*Member>
+IntrusiveList<T, Member>::IntrusiveList() {
+    root.prevP = root.nextP = &root;
+}
+
+template <typename T, ListHook T::*Member>
+IntrusiveList<T, Member>::~IntrusiveList() {
+    clear();
+}
+
+template <typename T, ListHook T::*Member>
+IntrusiveList<T, Member>::IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() {
+    steal(other);
+}
+
+template <typename T, ListHook T::*Member>
+IntrusiveList<T, Member>& IntrusiveList<T, Member>::operator=(IntrusiveList&& other) noexcept {
+    if (this != &other) {
+        clear();
+        steal(other);
+    }
+    return *this;
+}
+
+template <typename T, ListHook T::*Member>
+T& IntrusiveList<T, Member>::front() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return *fromHook(root.nextP);
+}
+
+template <typename T, ListHook T::*Member>
+const T& IntrusiveList<T, Member>::front() const {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return *fromHook(root.nextP);
+}
+
+template <typename T, ListHook T::*Member>
+T& IntrusiveList<T, Member>::back() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return *fromHook(root.prevP);
+}
+
+template <typename T, ListHook T::*Member>
+const T& IntrusiveList<T, Member>::back() const {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return *fromHook(root.prevP);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::push_front(T& value) {
+    insert(begin(), value);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::push_back(T& value) {
+    insert(end(), value);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(begin());
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(--end());
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::Iterator IntrusiveList<T, Member>::insert(ConstIterator pos, T& value) {
+    ListHook* hook = toHook(value);
+    if (hook->is_linked()) {
+        throw std::out_of_range("Object is already linked");
+    }
+    linkBefore(pos.hook, hook, hook, 1);
+    return Iterator(hook);
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::Iterator IntrusiveList<T, Member>::erase(ConstIterator pos) {
+    if (pos.hook == &root) {
+        throw std::out_of_range("Invalid erasing");
+    }
+    ListHook* hook = pos.hook;
+    ListHook* next = hook->nextP;
+    unlink(hook, hook, 1);
+    hook->prevP = hook->nextP = nullptr;
+    return Iterator(next);
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::Iterator IntrusiveList<T, Member>::erase(ConstIterator first, ConstIterator last) {
+    while (first != last) {
+        first = erase(first);
+    }
+    return Iterator(last.hook);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::erase(T& value) {
+    assert(contains(toHook(value)) && "IntrusiveList::erase: object is not in this list");
+    erase(ConstIterator(toHook(value)));
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::Iterator IntrusiveList<T, Member>::iterator_to(T& value) {
+    return Iterator(toHook(value));
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::ConstIterator IntrusiveList<T, Member>::iterator_to(const T& value) const {
+    return ConstIterator(const_cast<ListHook*>(&(value.*Member)));
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::splice(ConstIterator pos, IntrusiveList& other) {
+    if (this == &other || other.empty()) {
+        return;
+    }
+    splice(pos, other, other.begin(), other.end(), other._size);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::splice(ConstIterator pos, IntrusiveList& other, ConstIterator it) {
+    if (it.hook == &other.root) {
+        throw std::out_of_range("Invalid splicing");
+    }
+    splice(pos, other, it, ConstIterator(it.hook->nextP), 1);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::splice(ConstIterator pos, IntrusiveList& other, ConstIterator first, ConstIterator last) {
+    size_t count = 0;
+    if (this != &other) {
+        for (ConstIterator it = first; it != last; ++it) {
+            ++count;
+        }
+    }
+    splice(pos, other, first, last, count);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::splice(ConstIterator pos, IntrusiveList& other,
+                                      ConstIterator first, ConstIterator last, size_t count) {
+    if (first == last || pos == first || pos == last) {
+        return;
+    }
+    ListHook* firstHook = first.hook;
+    ListHook* lastHook = last.hook->prevP;
+
+    // внутри одного списка размер не меняется
+    size_t moved = this != &other ? count : 0;
+    other.unlink(firstHook, lastHook, moved);
+    linkBefore(pos.hook, firstHook, lastHook, moved);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::reverse() {
+    ListHook* current = &root;
+    do {
+        std::swap(current->prevP, current->nextP);
+        current = current->prevP;
+    } while (current != &root);
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::sort() {
+    sort(std::less<T>());
+}
+
+template <typename T, ListHook T::*Member>
+template <typename Compare>
+void IntrusiveList<T, Member>::sort(Compare comp) {
+    if (_size < 2) {
+        return;
+    }
+    auto hookComp = [&comp](const ListHook* left, const ListHook* right) {
+        return comp(*fromHook(left), *fromHook(right));
+    };
+    // кольцо размыкается в цепочку с nullptr на конце, как у List
+    ListHook* first = root.nextP;
+    root.prevP->nextP = nullptr;
+
+    auto restore = [this, &first] {
+        ListHook* prev = &root;
+        for (ListHook* hook = first; hook != nullptr; hook = hook->nextP) {
+            hook->prevP = prev;
+            prev->nextP = hook;
+            prev = hook;
+        }
+        prev->nextP = &root;
+        root.prevP = prev;
+    };
+    try {
+        sortNodes(first, hookComp);
+    }
+    catch (...) {
+        restore();
+        throw;
+    }
+    restore();
+}
+
+template <typename T, ListHook T::*Member>
+void IntrusiveList<T, Member>::clear() {
+    ListHook* hook = root.nextP;
+    while (hook != &root) {
+        ListHook* next = hook->nextP;
+        hook->prevP = hook->nextP = nullptr;
+        hook = next;
+    }
+    root.prevP = root.nextP = &root;
+    _size = 0;
+}
+
+template <typename T, ListHook T::*Member>
+bool IntrusiveList<T, Member>::empty() const {
+    return _size == 0;
+}
+
+template <typename T, ListHook T::*Member>
+size_t IntrusiveList<T, Member>::size() const {
+    return _size;
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::Iterator IntrusiveList<T, Member>::begin() {
+    return Iterator(root.nextP);
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::ConstIterator IntrusiveList<T, Member>::begin() const {
+    return ConstIterator(root.nextP);
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::Iterator IntrusiveList<T, Member>::end() {
+    return Iterator(&root);
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::ConstIterator IntrusiveList<T, Member>::end() const {
+    return ConstIterator(const_cast<ListHook*>(&root));
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::ConstIterator IntrusiveList<T, Member>::cbegin() const {
+    return begin();
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::ConstIterator IntrusiveList<T, Member>::cend() const {
+    return end();
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::reverse_iterator IntrusiveList<T, Member>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::const_reverse_iterator IntrusiveList<T, Member>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::reverse_iterator IntrusiveList<T, Member>::rend() {
+    return reverse_iterator(begin());
+}
+
+template <typename T, ListHook T::*Member>
+typename IntrusiveList<T, Member>::const_reverse_iterator IntrusiveList<T, Member>::rend() const {
+    return const_reverse_iterator(begin());
+}
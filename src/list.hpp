@@ -1,8 +1,76 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
 #include <iostream>
 #include <memory>
-
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "list_stats.hpp"
 #include "merge.hpp"
+#include "radix_sort.hpp"
+#include "serialize.hpp"
+
+#if defined(__cpp_lib_containers_ranges)
+using std::from_range_t;
+using std::from_range;
+#else
+/// @brief Метка конструктора контейнера из диапазона (```std::from_range_t``` из C++23)
+struct from_range_t {
+    explicit from_range_t() = default;
+};
+
+/// @brief Значение метки ```from_range_t```
+inline constexpr from_range_t from_range{};
+#endif
+
+/**
+ * @brief Политика выполнения для ```List::sort(policy, comp)```
+ * @details Без специализации тип политикой не считается. Специализации для
+ *      политик ```std::execution``` лежат в list_execution.hpp: в libstdc++
+ *      ```<execution>``` тянет за собой TBB, поэтому list.hpp его не включает
+ * @tparam Policy Тип политики
+ */
+template <typename Policy>
+struct ListExecutionPolicy {
+    static constexpr bool enabled = false;
+};
+
+/// @brief Последовательная сортировка
+struct ListSequencedPolicy {};
+
+/// @brief Параллельная сортировка на ```std::thread::hardware_concurrency()``` потоках
+struct ListParallelPolicy {};
+
+/// @brief Значение политики ```ListSequencedPolicy```
+inline constexpr ListSequencedPolicy listSeq{};
+
+/// @brief Значение политики ```ListParallelPolicy```
+inline constexpr ListParallelPolicy listPar{};
+
+template <>
+struct ListExecutionPolicy<ListSequencedPolicy> {
+    static constexpr bool enabled = true;
+    static constexpr bool parallel = false;
+};
+
+template <>
+struct ListExecutionPolicy<ListParallelPolicy> {
+    static constexpr bool enabled = true;
+    static constexpr bool parallel = true;
+};
 
 /**
  * @brief Класс двусвязного списка, аналогичный std::list<T>
@@ -10,13 +78,18 @@
  * @attention Класс создан для проработки понимания стандартной библиотеки C++.
  * В дальнейших комментариях термин "список" относится к данному классу ```List```, а
  *      "список инициализации" к ```std::initializer_list<T>```
+ * @tparam T Тип хранимых элементов
+ * @tparam Alloc Аллокатор элементов; для узлов перепривязывается к ```Node```
+ * @tparam Stats Политика статистики: ```NoListStats``` (ничего не считает) или ```CountingListStats```
  */
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>, typename Stats = NoListStats>
 class List {
 protected:
     /**
      * @name Узел (Node)
      * @brief Класс узла матрицы
+     * @details Поле ```data``` не инициализируется конструктором узла: элемент
+     *      создаётся отдельно через аллокатор списка (см. ```createNode```)
      */
     struct Node {
         /// @brief Указатель на предыдущий узел
@@ -25,27 +98,241 @@ protected:
         /// @brief Указатель на следующий узел
         Node* nextP = nullptr;
 
-        /// @brief Хранящиеся данные
-        T data;
+        union {
+            /// @brief Хранящиеся данные
+            T data;
+        };
 
         /**
          * @brief Конструктор узла
-         * @param data Хранящиеся данные
          * @param prevP Указатель на предыдущий узел
          * @param nextP Указатель на следующий узел
          */
-        Node(const T& data, Node* prevP = nullptr, Node* nextP = nullptr)
-            : data(data), prevP(prevP), nextP(nextP) {}
+        Node(Node* prevP = nullptr, Node* nextP = nullptr)
+            : prevP(prevP), nextP(nextP) {}
+
+        /// @brief Деструктор узла; ```data``` разрушается списком
+        ~Node() {}
+    };
+
+    /// @brief Аллокатор элементов, перепривязанный к узлам
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+
+    /// @brief Свойства аллокатора узлов
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
+
+    /// @brief Свойства аллокатора элементов
+    using ValueAllocTraits = std::allocator_traits<Alloc>;
+
+    /**
+     * @brief Непрерывный блок узлов, созданный ```compact``` или ```load```
+     * @details Узлы блока нельзя освобождать по одному: блок освобождается
+     *      целиком, когда в нём не остаётся живых узлов
+     */
+    struct Block {
+        /// @brief Первый узел блока
+        Node* nodes = nullptr;
+
+        /// @brief Количество узлов в блоке
+        size_t capacity = 0;
 
+        /// @brief Количество ещё не разрушенных узлов
+        size_t live = 0;
     };
 
+    /// @brief Блоки, упорядоченные по адресу
+    using Blocks = std::vector<Block, typename std::allocator_traits<Alloc>::template rebind_alloc<Block>>;
+
+    /**
+     * @brief Выделяет узел и конструирует в нём элемент
+     * @param prevP Указатель на предыдущий узел
+     * @param nextP Указатель на следующий узел
+     * @param args Аргументы конструктора элемента
+     * @return Указатель на новый узел (ещё не связанный со списком)
+     */
+    template <typename... Args>
+    Node* createNode(Node* prevP, Node* nextP, Args&&... args);
+
+    /**
+     * @brief Разрушает элемент узла и откладывает узел в запас для следующих вставок
+     * @param node Указатель на узел (уже вырезанный из списка)
+     */
+    void destroyNode(Node* node);
+
+    /**
+     * @brief Освобождает память узла, элемент которого уже разрушен
+     * @details Узел из блока не освобождается, а уменьшает счётчик блока
+     * @param node Указатель на узел
+     */
+    void freeNode(Node* node);
+
+    /// @brief Освобождает все запасные узлы
+    void releaseSpare();
+
+    /// @brief Ищет блок, которому принадлежит узел
+    /// @param node Указатель на узел
+    /// @return Итератор на блок или ```_blocks.end()```
+    typename Blocks::iterator findBlock(const Node* node);
+
+    /**
+     * @brief Переносит ```count``` узлов подряд, начиная с ```first```, в новый блок
+     * @details Элементы перемещаются в порядке обхода, старые узлы освобождаются.
+     *      Если перемещение элемента бросает исключение, уже перенесённые узлы
+     *      остаются в новом блоке, остальные - на месте
+     * @param first Первый переносимый узел
+     * @param count Количество переносимых узлов (не больше, чем их до конца списка)
+     */
+    void relocateNodes(Node* first, size_t count);
+
+    /// @brief Забирает блоки ```other```, узлы которого целиком переходят в текущий список
+    /// @param other Список с тем же аллокатором
+    void adoptBlocks(List& other);
+
+    /// @brief Регистрирует блок, не бросая исключений (место в ```_blocks``` зарезервировано)
+    /// @param nodes Начало блока
+    /// @param capacity Количество узлов в блоке
+    /// @param live Количество живых узлов; при нуле блок освобождается сразу
+    void insertBlock(Node* nodes, size_t capacity, size_t live);
+
+    /**
+     * @brief Добавляет в конец ```count``` элементов, скопированных побайтно, одним блоком узлов
+     * @details Только для тривиально копируемых ```T```
+     * @param bytes ```count * sizeof(T)``` байт элементов
+     * @param count Количество элементов (больше нуля)
+     */
+    void appendBlock(const unsigned char* bytes, size_t count);
+
+    /// @brief Заголовок двоичного представления ```save```
+    struct StreamHeader {
+        /// @brief Сигнатура ```streamMagic```
+        uint32_t magic;
+
+        /// @brief ```sizeof(T)``` записавшего списка
+        uint32_t elementSize;
+
+        /// @brief Количество элементов
+        uint64_t count;
+    };
+
+    /// @brief Сигнатура потока: "DLL1"
+    static constexpr uint32_t streamMagic = 0x314C4C44;
+
+    /**
+     * @brief Встраивает готовый узел в список перед ```next```
+     * @param next Узел, перед которым встраивается новый; ```nullptr``` - в конец
+     * @param node Встраиваемый узел
+     */
+    void linkBefore(Node* next, Node* node);
+
+    /**
+     * @brief Встраивает готовую цепочку узлов [```first```, ```last```] перед ```next```
+     * @param next Узел, перед которым встраивается цепочка; ```nullptr``` - в конец
+     * @param first Первый узел цепочки
+     * @param last Последний узел цепочки (включительно)
+     * @param count Количество узлов в цепочке
+     */
+    void linkNodesBefore(Node* next, Node* first, Node* last, size_t count);
+
+    /**
+     * @brief Вырезает цепочку узлов [```first```, ```last```] из списка, не освобождая их
+     * @param first Первый узел цепочки
+     * @param last Последний узел цепочки (включительно)
+     * @param count Количество узлов в цепочке
+     */
+    void unlinkNodes(Node* first, Node* last, size_t count);
+
+    /**
+     * @brief Освобождает цепочку узлов, уже вырезанную из списка
+     * @param first Первый узел цепочки (завершается ```nullptr```)
+     * @return Количество освобождённых узлов
+     */
+    size_t destroyNodes(Node* first);
+
+    /**
+     * @brief Собирает узлы текущего списка из ```[first, last)``` и вставляет их перед ```pos```
+     * @details Если конструктор элемента бросил исключение, собранные узлы освобождаются,
+     *      а список не меняется
+     * @param pos Позиция для вставки
+     * @param first Начало последовательности
+     * @param last Конец последовательности
+     * @return Итератор на первый вставленный элемент или ```pos```, если последовательность пуста
+     */
+    template <typename InputIt, typename Sentinel>
+    typename List::Iterator insertNodes(typename List::ConstIterator pos, InputIt first, Sentinel last);
     
     /**
      * @brief Функция обмена данными между ```copy``` и текущим списком
+     * @details Обмениваются только узлы; аллокаторы остаются на месте
      * @param copy Список, с которым обменивается данными текущий
      */
     void swapThis(List& copy);
 
+    /**
+     * @brief Заменяет содержимое текущего списка узлами ```tmp```
+     * @details Прежние узлы освобождаются через ```tmp```, а его счётчики прибавляются
+     *      к статистике текущего списка
+     * @param tmp Список, собранный вместо текущего; после вызова пуст
+     */
+    void replaceWith(List& tmp);
+
+    /**
+     * @brief Забирает узлы ```other``` в конец текущего списка
+     * @details Если аллокаторы не равны, элементы перемещаются поштучно
+     * @param other Список, узлы которого забираются
+     */
+    void takeNodes(List& other);
+
+    /// @brief Направление поразрядной сортировки для компаратора ```Compare```
+    /// @details 1 - ```std::less```, -1 - ```std::greater``` над арифметическим ```T```,
+    ///     0 - только сортировка сравнением
+    template <typename Compare>
+    static constexpr int radixDirection = !isRadixKey<T> ? 0
+        : (std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::less<>>) ? 1
+        : (std::is_same_v<Compare, std::greater<T>> || std::is_same_v<Compare, std::greater<>>) ? -1
+        : 0;
+
+    /// @brief Поразрядная сортировка по беззнаковому ключу с перевязкой узлов
+    /// @param key Функция элемента, возвращающая беззнаковый ключ
+    template <typename KeyOf>
+    void radixSort(KeyOf key);
+
+    /// @brief Восстанавливает ```prevP``` и ```tail``` по цепочке ```nextP```, начиная с ```head```
+    /// @details Узлы, у которых сменился предыдущий, учитываются в статистике как перевязанные
+    void restoreBackLinks();
+
+    /// @brief Шаг, с которым подгружаются кэш-линии узла
+    static constexpr size_t prefetchStride = 64;
+
+    /// @brief Копировать ли элементы пачки в массив, чтобы сравнения векторизовались
+    static constexpr bool gatherValues = std::is_arithmetic_v<T>;
+
+    /// @brief Просит процессор заранее подгрузить все кэш-линии узла
+    /// @param node Указатель на узел
+    static void prefetchNode(const Node* node);
+
+    /**
+     * @brief Собирает в ```batch``` до ```scanBatch``` узлов, начиная с ```node```
+     * @param node Первый узел; сдвигается за последний собранный
+     * @param batch Массив под узлы пачки
+     * @return Количество собранных узлов
+     */
+    static size_t gatherBatch(Node*& node, Node** batch);
+
+    /**
+     * @brief Обходит список пачками по ```scanBatch``` узлов
+     * @details Следующая пачка собирается до обработки текущей, поэтому промахи
+     *      по её узлам перекрываются с работой над текущей. Обработчик может
+     *      вырезать узлы текущей пачки, но не трогает остальные
+     * @param visit Обработчик: принимает узлы пачки и их количество, возвращает
+     *      номер узла, на котором обход останавливается, или количество узлов
+     * @return Узел, на котором обход остановился, или ```nullptr```
+     */
+    template <typename Visit>
+    Node* scanNodes(Visit visit) const;
+
+    /// @brief Аллокатор узлов
+    NodeAlloc _alloc;
+
     /// @brief Указатель на первый укел списка
     Node* head = nullptr;
 
@@ -54,32 +341,84 @@ protected:
 
     /// @brief Количество элементов списка
     size_t _size = 0;
+
+    /// @brief Блоки узлов, созданные ```compact``` и ```load```; пуст, пока они не вызывались
+    Blocks _blocks;
+
+    /// @brief Последний узел, перенесённый пошаговым ```compact```; ```nullptr``` - с начала
+    Node* _compactTail = nullptr;
+
+    /// @brief Запасные узлы без элементов, связанные через ```nextP```
+    Node* _spare = nullptr;
+
+    /// @brief Количество запасных узлов
+    size_t _spareCount = 0;
+
+    /// @brief Счётчики статистики; без статистики не занимает места
+    [[no_unique_address]] mutable Stats _stats;
     
 public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Размер списка, начиная с которого ```sort``` с несколькими потоками
+    ///     действительно распараллеливается; меньшие списки сортируются последовательно
+    static constexpr size_t parallelSortThreshold = 1 << 15;
+
+    /// @brief Размер списка, начиная с которого ```sort``` арифметических элементов
+    ///     и ```sort_by_key``` с арифметическим ключом сортируют поразрядно
+    static constexpr size_t radixSortThreshold = 64;
+
+    /// @brief Сколько узлов пошаговый ```compact``` переносит в один блок между проверками времени
+    static constexpr size_t compactChunk = 1 << 14;
+
+    /// @brief Размер порции, которой ```save``` и ```load``` пишут и читают тривиально копируемые элементы
+    static constexpr size_t ioChunkBytes = 1 << 16;
+
+    /// @brief Размер пачки узлов в ```for_each```, ```find```, ```count_if``` и других обходах
+    static constexpr size_t scanBatch = 8;
 
     /// @brief Заполняет поля класса базовыми значениями
     List();
 
+    /// @brief Создаёт пустой список с заданным аллокатором
+    /// @param alloc Аллокатор
+    explicit List(const Alloc& alloc);
+
     /**
      * @brief Заполненяет список ```count``` элементами значения ```alloc_elem```
      * @param count Количество элементов
      * @param alloc_elem Элемент для заполнения списка
+     * @param alloc Аллокатор
      */
-    List(size_t count, const T& alloc_elem);
+    List(size_t count, const T& alloc_elem, const Alloc& alloc = Alloc());
 
     /**
      * @brief Заполненяет список значениями из ```std::initializer_list<T>```
      * @param initList Список инициализации
+     * @param alloc Аллокатор
      */
-    List(std::initializer_list<T> initList);
+    List(std::initializer_list<T> initList, const Alloc& alloc = Alloc());
 
     /**
      * @brief Заполняет список с помощью итераторов
      * @param from Итератор на первый принимаемый элемент
      * @param to Итератор на последний принимаемый элемент
+     * @param alloc Аллокатор
      */
-    List(typename List<T>::Iterator from, typename List<T>::Iterator to);
+    List(typename List::ConstIterator from, typename List::ConstIterator to, const Alloc& alloc = Alloc());
 
+    /**
+     * @brief Заполняет список элементами любого входного диапазона за один проход
+     * @details Удобно для материализации конвейера ```std::views```; подробнее в ```insert_range```
+     * @param range Диапазон, элементы которого приводятся к ```T```
+     * @param alloc Аллокатор
+     */
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+    List(from_range_t, R&& range, const Alloc& alloc = Alloc());
 
     /// правило пяти
 
@@ -87,80 +426,130 @@ public:
     ~List();
 
     /// @brief Конструктор копирования (глубинное)
+    /// @details Аллокатор получается через ```select_on_container_copy_construction```
     /// @param other Копируемый список
-    List(const List<T>& other);
+    List(const List& other);
+
+    /// @brief Конструктор копирования с заданным аллокатором
+    /// @param other Копируемый список
+    /// @param alloc Аллокатор нового списка
+    List(const List& other, const Alloc& alloc);
 
     /// @brief Контруктор перемещения
     /// @param other Перемещаемый объект
-    List(List<T>&& other);
+    List(List&& other) noexcept;
+
+    /// @brief Конструктор перемещения с заданным аллокатором
+    /// @details Если ```alloc``` не равен аллокатору ```other```, элементы перемещаются поштучно
+    /// @param other Перемещаемый объект
+    /// @param alloc Аллокатор нового списка
+    List(List&& other, const Alloc& alloc);
 
     /// @brief Оператор копирующего присваивания
     /// @param other Копируемый список
     /// @return Ссылка на текущий список
-    List<T>& operator=(const List<T>& other);
+    List& operator=(const List& other);
 
     /// @brief Оператор перемещающего присваивания
+    /// @details Если аллокатор не распространяется при перемещении и не равен
+    ///     аллокатору ```other```, элементы перемещаются поштучно
     /// @param other Перемещаемый список
     /// @return Ссылка на текущий список
-    List<T>& operator=(List<T>&& other);
+    List& operator=(List&& other) noexcept(
+        NodeAllocTraits::propagate_on_container_move_assignment::value ||
+        NodeAllocTraits::is_always_equal::value);
 
-    /// @brief Двунаправленный итератор для обхода списка
-    struct Iterator {
+    /// @brief Обмен содержимым с другим списком
+    /// @details Аллокаторы обмениваются, только если это разрешает
+    ///     ```propagate_on_container_swap```; при неравных аллокаторах элементы перемещаются
+    /// @param other Список для обмена
+    void swap(List& other);
+
+    /// @brief Возвращает копию аллокатора списка
+    /// @return Аллокатор элементов
+    Alloc get_allocator() const;
+
+    /**
+     * @brief Двунаправленный итератор для обхода списка
+     * @details Удовлетворяет требованиям ```std::bidirectional_iterator```.
+     *      Итератор ```end()``` хранит ```nullptr``` в качестве узла и указатель на список,
+     *      поэтому ```--end()``` возвращает итератор на последний элемент
+     * @tparam IsConst ```true``` для итератора на константные элементы
+     */
+    template <bool IsConst>
+    struct BasicIterator {
         friend class List;
+        template <bool> friend struct BasicIterator;
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        /// @brief Создаёт итератор, не связанный ни с одним списком
+        BasicIterator() = default;
         
         /// @brief Конструирование на основе узла
         /// @param node Указатель на узел
-        explicit Iterator(Node* node) : node(node) {}
+        /// @param owner Список, которому принадлежит узел (нужен для сдвига от ```end()```)
+        explicit BasicIterator(Node* node, const List* owner = nullptr) : node(node), owner(owner) {}
+
+        /// @brief Преобразование итератора в константный
+        /// @param other Неконстантный итератор
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) : node(other.node), owner(other.owner) {}
         
         /// @brief Оператор сложения; сдвиг на ```shift``` элементов влево
         /// @param shift На сколько элементов сдвинуть итератор влево
         /// @return Итератор, указывающий на элемент в позиции ``` позиция текущего узла + shift```
         /// @exception При попытке выйти за пределы списка
-        Iterator operator+(size_t shift) const;
+        BasicIterator operator+(size_t shift) const;
         
         /// @brief Оператор вычитания; сдвиг на ```shift``` элементов вправо
         /// @param shift На сколько элементов сдвинуть итератор вправо
         /// @return Итератор, указывающий на элемент в позиции ``` позиция текущего узла - shift```
         /// @exception При попытке выйти за пределы списка
-        Iterator operator-(size_t shift) const;
+        BasicIterator operator-(size_t shift) const;
 
         
         /// @brief Пре-инктрементный сдвиг на один элемент влево
         /// @return Итератор, указывающий на следующий элемент
-        Iterator& operator++();
+        BasicIterator& operator++();
         
         /// @brief Пост-инктрементный сдвиг на один элемент влево
         /// @return Итератор, указывающий на следующий элемент
-        Iterator operator++(int);
+        BasicIterator operator++(int);
         
         
         /// @brief Пре-инктрементный сдвиг на один элемент вправо
         /// @return Итератор, указывающий на следующий элемент
-        Iterator& operator--();
+        BasicIterator& operator--();
         
         /// @brief Пост-инктрементный сдвиг на один элемент вправо
         /// @return Итератор, указывающий на следующий элемент
-        Iterator operator--(int);
-        
-        /// @brief Оператор копирующего присваиваний
-        /// @param it Копируемый итератор
-        /// @return Ссылка на текущий итератор
-        Iterator& operator=(const Iterator& it);
+        BasicIterator operator--(int);
 
         
         /// @brief Сравнение двух итераторов (указателей на их элементы)
         /// @param other Сравниваемый итератор
         /// @return Результат сравнения
-        bool operator==(const Iterator& other) const;
+        template <bool OtherConst>
+        bool operator==(const BasicIterator<OtherConst>& other) const;
         
         /// @brief Проверка на неравенство двух итераторов (указателей на их элементы)
         /// @param other Сравниваемый итератор
         /// @return Результат сравнения
-        bool operator!=(const Iterator& other) const;
+        template <bool OtherConst>
+        bool operator!=(const BasicIterator<OtherConst>& other) const;
 
         /// @brief Даёт доступ к элементу, на который указывает итератор
-        /// @return Элемент, на который указывает итератор
-        T operator*();
+        /// @return Ссылка на элемент, на который указывает итератор
+        reference operator*() const;
+
+        /// @brief Доступ к членам элемента, на который указывает итератор
+        /// @return Указатель на элемент
+        pointer operator->() const;
     
         /// @brief Даёт доступ к указателю на текущий узел извне
         /// @return Указатель на текущий узел
@@ -169,13 +558,27 @@ public:
     protected:
         /// @brief Текущий узел
         Node* node = nullptr;
+
+        /// @brief Список, из которого получен итератор
+        const List* owner = nullptr;
     };
+
+    /// @brief Итератор на изменяемые элементы
+    using Iterator = BasicIterator<false>;
+
+    /// @brief Итератор на константные элементы
+    using ConstIterator = BasicIterator<true>;
+
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
     
 
     /// @brief Инициализация списка через ```std::initializer_list<T>```
     /// @param initList Список инициализации
     /// @return Ссылка на текущий список
-    List<T>& operator=(std::initializer_list<T> initList);
+    List& operator=(std::initializer_list<T> initList);
     
     /// @brief Поэлементное сравнение двух списков 
     /// @param other Сравниваемый элемент
@@ -190,66 +593,419 @@ public:
 
     /// @brief Доступ к первому элементу списка
     /// @return Первый элемент
-    T front() const;
+    T& front();
+
+    /// @brief Доступ к первому элементу константного списка
+    /// @return Первый элемент
+    const T& front() const;
 
     /// @brief Доступ к последнему элементу списка
     /// @return Последний элемент
-    T back() const;
+    T& back();
+
+    /// @brief Доступ к последнему элементу константного списка
+    /// @return Последний элемент
+    const T& back() const;
 
     /// @brief Добавления в начало списка
     /// @param data Добавляемые данные
     void push_front(const T& data);
     
+    /// @brief Добавление в начало списка перемещением
+    /// @param data Перемещаемые данные
+    void push_front(T&& data);
+    
     /// @brief Добавления в конец списка
     /// @param data Добавляемые данные
     void push_back(const T& data);
     
+    /// @brief Добавление в конец списка перемещением
+    /// @param data Перемещаемые данные
+    void push_back(T&& data);
+
+    /// @brief Конструирует элемент прямо в новом узле в начале списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_front(Args&&... args);
+
+    /// @brief Конструирует элемент прямо в новом узле в конце списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+    
     /// @brief Удаление из начала списка
     void pop_front();
     
+    /// @brief Удаление из начала списка с перемещением элемента в ```out```
+    /// @param out Куда перемещается удаляемый элемент
+    void pop_front(T& out);
+    
     /// @brief Удаление из конца списка
     void pop_back();
 
+    /// @brief Удаление из конца списка с перемещением элемента в ```out```
+    /// @param out Куда перемещается удаляемый элемент
+    void pop_back(T& out);
+
 
     /// @brief Вставка элемента в позицию
     /// @param pos Итератор, указывающий на позицию для вставки
     /// @param value Вставляемое значение
-    void insert(const Iterator& pos, const T& value);
+    /// @return Итератор на вставленный элемент
+    Iterator insert(ConstIterator pos, const T& value);
+
+    /// @brief Вставка элемента в позицию перемещением
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param value Перемещаемое значение
+    /// @return Итератор на вставленный элемент
+    Iterator insert(ConstIterator pos, T&& value);
+
+    /// @brief Конструирует элемент прямо в новом узле перед ```pos```
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param args Аргументы конструктора элемента
+    /// @return Итератор на созданный элемент
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args);
 
     /// @brief Вставка нескольких элементов в позицию
+    /// @details Элементы собираются в цепочку вне списка и встраиваются одним
+    ///     ```splice```; при исключении список не меняется
     /// @param pos Итератор, указывающий на позицию для вставки
     /// @param initList Вставляемые значения
-    void insert(const Iterator& pos, std::initializer_list<T> initList);
+    /// @return Итератор на первый вставленный элемент или ```pos```, если вставлять нечего
+    Iterator insert(ConstIterator pos, std::initializer_list<T> initList);
+
+    /// @brief Вставка ```count``` копий ```value``` в позицию
+    /// @details Строгая гарантия исключений, как у вставки списка инициализации
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param count Количество вставляемых элементов
+    /// @param value Вставляемое значение
+    /// @return Итератор на первый вставленный элемент или ```pos```, если ```count``` равен 0
+    Iterator insert(ConstIterator pos, size_t count, const T& value);
+
+    /// @brief Вставка элементов диапазона [```first```, ```last```) в позицию
+    /// @details Строгая гарантия исключений, как у вставки списка инициализации
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param first Итератор на первый вставляемый элемент
+    /// @param last Итератор, до которого идёт вставка
+    /// @return Итератор на первый вставленный элемент или ```pos```, если диапазон пуст
+    template <typename InputIt, typename = std::enable_if_t<std::is_convertible_v<
+        typename std::iterator_traits<InputIt>::iterator_category, std::input_iterator_tag>>>
+    Iterator insert(ConstIterator pos, InputIt first, InputIt last);
+
+    /// @brief Вставка элементов непрерывного массива в позицию
+    /// @details Строгая гарантия исключений, как у вставки списка инициализации
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param values Вставляемые значения
+    /// @return Итератор на первый вставленный элемент или ```pos```, если ```values``` пуст
+    Iterator insert(ConstIterator pos, std::span<const T> values);
+
+    /// @brief Вставка элементов входного диапазона в позицию
+    /// @details Диапазон обходится один раз: элементы собираются в цепочку на запасных
+    ///     или по одному выделенных узлах и встраиваются в список целиком, поэтому
+    ///     узлы остаются независимыми и свободно переходят между списками.
+    ///     Строгая гарантия исключений
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param range Диапазон, элементы которого приводятся к ```T```
+    /// @return Итератор на первый вставленный элемент или ```pos```, если диапазон пуст
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+    Iterator insert_range(ConstIterator pos, R&& range);
+
+    /// @brief Добавляет элементы входного диапазона в конец списка
+    /// @details То же, что ```insert_range(end(), range)```
+    /// @param range Диапазон, элементы которого приводятся к ```T```
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+    void append_range(R&& range);
 
     /// @brief Удаление элемента в позиции
     /// @param pos Позиция удаляемого элемента
     /// @return Итератор на следующий элемент
-    Iterator erase(const Iterator& pos);    
+    Iterator erase(ConstIterator pos);    
     
     /// @brief Удаление элементов в диапазоне [```first```, ```last```)
+    /// @details Диапазон вырезается из списка целиком, затем узлы освобождаются
     /// @param first Первый удаляемый элемент
     /// @param last Элемент, до которого идёт удаление
     /// @return Итератор на элемент last
-    Iterator erase(const Iterator& first, const Iterator& last);
+    Iterator erase(ConstIterator first, ConstIterator last);
     
 
+    /// @brief Переносит все узлы ```other``` перед ```pos```
+    /// @details Только перевязывает указатели: память не выделяется, элементы
+    ///     не копируются. Если аллокаторы не равны, элементы перемещаются поштучно
+    /// @param pos Позиция, перед которой вставляются узлы
+    /// @param other Список-источник (не должен совпадать с текущим)
+    void splice(ConstIterator pos, List& other);
+
+    /// @copydoc splice(ConstIterator, List&)
+    void splice(ConstIterator pos, List&& other);
+
+    /// @brief Переносит один узел ```it``` из ```other``` перед ```pos```
+    /// @details Узел из блока ```other``` (после ```compact``` или ```load```) не может
+    ///     уйти в другой список поодиночке: элемент перемещается в новый узел, а
+    ///     итераторы на него становятся недействительными
+    /// @param pos Позиция, перед которой вставляется узел
+    /// @param other Список-источник (может совпадать с текущим)
+    /// @param it Переносимый элемент ```other```
+    void splice(ConstIterator pos, List& other, ConstIterator it);
+
+    /// @copydoc splice(ConstIterator, List&, ConstIterator)
+    void splice(ConstIterator pos, List&& other, ConstIterator it);
+
+    /// @brief Переносит узлы [```first```, ```last```) из ```other``` перед ```pos```
+    /// @details Для подсчёта ```_size``` диапазон проходится за O(n), если
+    ///     ```other``` - другой список; без прохода работает перегрузка с ```count```
+    /// @param pos Позиция, перед которой вставляются узлы (не внутри диапазона)
+    /// @param other Список-источник (может совпадать с текущим)
+    /// @param first Первый переносимый элемент
+    /// @param last Элемент, до которого идёт перенос
+    void splice(ConstIterator pos, List& other, ConstIterator first, ConstIterator last);
+
+    /// @copydoc splice(ConstIterator, List&, ConstIterator, ConstIterator)
+    void splice(ConstIterator pos, List&& other, ConstIterator first, ConstIterator last);
+
+    /// @brief Переносит узлы [```first```, ```last```) известной длины за O(1)
+    /// @details Если ```other``` - другой список с блоками (```compact```, ```load```),
+    ///     а переносится не весь он, элементы перемещаются в новые узлы за O(n)
+    /// @param pos Позиция, перед которой вставляются узлы (не внутри диапазона)
+    /// @param other Список-источник (может совпадать с текущим)
+    /// @param first Первый переносимый элемент
+    /// @param last Элемент, до которого идёт перенос
+    /// @param count Количество элементов в диапазоне; должно быть точным
+    void splice(ConstIterator pos, List& other, ConstIterator first, ConstIterator last, size_t count);
+
     /// @brief Соединение списков копированием
     /// @param other Добавляемый в конец список
-    void merge(const List<T>& other);
+    void merge(const List& other);
     
     /// @brief Соединение списков перемещением
+    /// @details Эквивалентно ```splice(end(), other)```; слияние отсортированных списков - ```merge(other, comp)```
     /// @param other Добавляемый в конец список
-    void merge(List<T>&& other);
+    void merge(List&& other);
+
+    /// @brief Слияние двух отсортированных списков перевязкой узлов
+    /// @details Устойчиво: при равенстве первыми идут элементы текущего списка.
+    ///     Работает за O(n + m) без выделения памяти, если аллокаторы равны; иначе
+    ///     элементы ```other``` сначала перемещаются в новые узлы. Если ```comp```
+    ///     бросает исключение, все элементы остаются в текущем списке
+    /// @param other Отсортированный список; после слияния пуст
+    /// @param comp Компаратор, по которому отсортированы оба списка
+    template <typename Compare>
+    void merge(List& other, Compare comp);
+
+    /// @copydoc merge(List&, Compare)
+    template <typename Compare>
+    void merge(List&& other, Compare comp);
     
     /// @brief Сортирует элементов в списке 
-    /// @details Используется сортировка слиянием
+    /// @details Используется сортировка слиянием; целые и числа с плавающей точкой
+    ///     сортируются поразрядно (см. ```sort(Compare)```)
     void sort();
     
+    /// @brief Сортирует элементы списка с помощью компаратора
+    /// @details Устойчивая сортировка слиянием, которая только перевязывает узлы:
+    ///     память не выделяется, элементы не копируются и не перемещаются.
+    ///     Если ```T``` - целый тип или ```float```/```double```, а ```comp``` - ```std::less```
+    ///     или ```std::greater```, списки от ```radixSortThreshold``` элементов сортируются
+    ///     поразрядно за O(n) с временным массивом указателей на узлы
+    /// @param comp Компаратор: ```true```, если первый элемент строго меньше второго
+    template <typename Compare, typename = std::enable_if_t<!std::is_integral_v<Compare> &&
+        !ListExecutionPolicy<std::decay_t<Compare>>::enabled>>
+    void sort(Compare comp);
+
+    /// @brief Сортирует элементы списка в ```threads``` потоках
+    /// @details Список режется на ```threads``` частей, которые сортируются параллельно
+    ///     перевязкой узлов, после чего отсортированные части попарно сливаются,
+    ///     тоже параллельно. Сортировка устойчива, узлы не выделяются и не копируются.
+    ///     Каждый поток работает со своей копией ```comp```
+    /// @param threads Количество потоков; при 0 или 1 сортировка последовательная
+    /// @param comp Компаратор: ```true```, если первый элемент строго меньше второго
+    /// @param threshold Размер, меньше которого список сортируется последовательно
+    template <typename Compare = std::less<T>>
+    void sort(size_t threads, Compare comp = Compare(), size_t threshold = parallelSortThreshold);
+
+    /// @brief Сортирует элементы списка с политикой выполнения
+    /// @details ```listSeq``` - последовательная сортировка, ```listPar``` - на
+    ///     ```std::thread::hardware_concurrency()``` потоках; политики ```std::execution```
+    ///     принимаются после включения list_execution.hpp
+    /// @param policy Политика выполнения, для которой специализирован ```ListExecutionPolicy```
+    /// @param comp Компаратор: ```true```, если первый элемент строго меньше второго
+    template <typename ExecutionPolicy, typename Compare = std::less<T>,
+        typename = std::enable_if_t<ListExecutionPolicy<std::decay_t<ExecutionPolicy>>::enabled>>
+    void sort(ExecutionPolicy&& policy, Compare comp = Compare());
+    
+    /// @brief Устойчиво сортирует элементы по возрастанию ключа
+    /// @details Если ключ - целый тип или ```float```/```double```, списки от
+    ///     ```radixSortThreshold``` элементов сортируются поразрядно, иначе слиянием
+    ///     со сравнением ключей через ```<```. ```key``` вызывается несколько раз для каждого элемента
+    /// @param key Проекция: принимает ```const T&``` и возвращает ключ
+    template <typename KeyOf>
+    void sort_by_key(KeyOf key);
+
     /// @brief Оборачиваени списка (элементы в обратном порядке)
     void reverse();
 
-    /// @brief Удаляет все элементы списка 
-    void clear();
+    /// @brief Применяет ```fn``` к каждому элементу по порядку
+    /// @details Как и остальные обходы ниже, идёт пачками по ```scanBatch``` узлов
+    ///     с упреждающей подгрузкой, что быстрее цикла по итераторам
+    /// @param fn Функция, принимающая ссылку на элемент
+    /// @return ```fn``` после обхода
+    template <typename Fn>
+    Fn for_each(Fn fn);
+
+    /// @copydoc for_each(Fn)
+    template <typename Fn>
+    Fn for_each(Fn fn) const;
+
+    /// @brief Ищет первый элемент, равный ```value```
+    /// @details Для арифметических типов пачка сравнивается без ветвлений
+    /// @param value Искомое значение
+    /// @return Итератор на найденный элемент или ```end()```
+    Iterator find(const T& value);
+
+    /// @copydoc find(const T&)
+    ConstIterator find(const T& value) const;
+
+    /// @brief Ищет первый элемент, для которого ```pred``` вернул ```true```
+    /// @param pred Предикат
+    /// @return Итератор на найденный элемент или ```end()```
+    template <typename Pred>
+    Iterator find_if(Pred pred);
+
+    /// @copydoc find_if(Pred)
+    template <typename Pred>
+    ConstIterator find_if(Pred pred) const;
+
+    /// @brief Считает элементы, для которых ```pred``` вернул ```true```
+    /// @details Для арифметических типов предикат применяется к копиям элементов пачки
+    /// @param pred Предикат
+    /// @return Количество элементов
+    template <typename Pred>
+    size_t count_if(Pred pred) const;
+
+    /// @brief Сворачивает элементы слева направо: ```init = op(init, элемент)```
+    /// @param init Начальное значение
+    /// @param op Бинарная операция
+    /// @return Результат свёртки
+    template <typename U, typename BinaryOp = std::plus<>>
+    U accumulate(U init, BinaryOp op = BinaryOp()) const;
+
+    /// @brief Удаляет элементы, для которых ```pred``` вернул ```true```
+    /// @details Узлы освобождаются после обхода, поэтому ```pred``` может ссылаться
+    ///     на элементы самого списка
+    /// @param pred Предикат
+    /// @return Количество удалённых элементов
+    template <typename Pred>
+    size_t remove_if(Pred pred);
+
+    /// @brief Удаляет элементы, равные ```value```
+    /// @details ```value``` может ссылаться на элемент самого списка
+    /// @param value Удаляемое значение
+    /// @return Количество удалённых элементов
+    size_t remove(const T& value);
+
+    /// @brief Оставляет по одному элементу из каждой группы подряд идущих равных
+    /// @return Количество удалённых элементов
+    size_t unique();
+
+
+    /// @brief Оставляет первый элемент из каждой группы подряд идущих эквивалентных
+    /// @param pred Бинарный предикат: ```true```, если элементы эквивалентны
+    /// @return Количество удалённых элементов
+    template <typename BinaryPred>
+    size_t unique(BinaryPred pred);
+
+    /// @brief Устойчиво делит список на два перевязкой узлов
+    /// @details Элементы, для которых ```pred``` вернул ```true```, остаются в текущем
+    ///     списке, остальные в прежнем порядке переходят в возвращаемый. Узлы из
+    ///     блоков (```compact```, ```load```) не могут перейти в другой список,
+    ///     поэтому их элементы перемещаются в новые узлы. Если ```pred``` бросает
+    ///     исключение, уже отвергнутые элементы возвращаются в конец текущего списка
+    /// @param pred Предикат
+    /// @return Список отвергнутых элементов с аллокатором текущего
+    template <typename Pred>
+    List partition(Pred pred);
+
+    /// @brief Делит список, как ```partition(pred)```, в список с аллокатором ```alloc```
+    /// @details Если ```alloc``` не равен аллокатору текущего списка, отвергнутые
+    ///     элементы перемещаются в новые узлы
+    /// @param pred Предикат
+    /// @param alloc Аллокатор возвращаемого списка
+    /// @return Список отвергнутых элементов
+    template <typename Pred>
+    List partition(Pred pred, const Alloc& alloc);
+
+    /// @brief Переносит все узлы в один непрерывный блок в порядке обхода
+    /// @details После этого обход читает память подряд. Элементы перемещаются,
+    ///     поэтому все итераторы, указатели и ссылки на них становятся недействительными.
+    ///     Блок освобождается, когда освобождён последний его узел (удалённые
+    ///     узлы держатся в запасе до ```shrink_to_fit``` или ```clear```)
+    void compact();
+
+    /// @brief Пошагово переносит узлы в непрерывные блоки, пока не истечёт ```budget```
+    /// @details За шаг в новый блок переносится до ```compactChunk``` узлов,
+    ///     следующий вызов продолжает с места остановки; хотя бы один шаг делается
+    ///     всегда. Итераторы на перенесённые элементы становятся недействительными
+    /// @param budget Время, после которого новые шаги не начинаются
+    /// @return ```true```, если проход дошёл до конца списка; следующий вызов
+    ///     начинает новый проход с начала
+    bool compact(std::chrono::nanoseconds budget);
+
+    /// @brief Записывает список в двоичном виде
+    /// @details Тривиально копируемые элементы пишутся порциями по ```ioChunkBytes```
+    ///     байт с длиной впереди, остальные - через ```ListSerializer<T>```.
+    ///     Формат зависит от платформы: порядок байт и ```sizeof(T)``` не переводятся
+    /// @param out Поток
+    /// @exception std::runtime_error Если запись не удалась
+    void save(std::ostream& out) const;
+
+    /// @brief Записывает список в файловый дескриптор
+    /// @param fd Открытый на запись дескриптор; не закрывается
+    /// @exception std::system_error Если системный вызов не удался
+    void save(int fd) const;
+
+    /// @brief Заменяет содержимое списком, записанным ```save```
+    /// @details Поток читается порциями по ```ioChunkBytes``` байт, каждая порция
+    ///     тривиально копируемых элементов становится одним непрерывным блоком узлов,
+    ///     как после ```compact```. Поэтому отдельные элементы и части такого списка
+    ///     при ```splice``` в другой список и ```partition``` перемещаются в новые узлы,
+    ///     а не перевязываются; ```splice``` всего списка по-прежнему O(1).
+    ///     При ошибке список не меняется
+    /// @param in Поток
+    /// @exception std::runtime_error Если поток повреждён или закончился раньше
+    void load(std::istream& in);
+
+    /// @brief Заменяет содержимое списком, прочитанным из файлового дескриптора
+    /// @details Дескриптор читается с упреждением, поэтому данные после списка
+    ///     могут оказаться прочитанными, а смещение ```fd``` после вызова не определено:
+    ///     следующие данные нужно читать с известного смещения, а не с текущего
+    /// @param fd Открытый на чтение дескриптор; не закрывается
+    /// @exception std::system_error Если системный вызов не удался
+    void load(int fd);
+
+    /// @brief Удаляет все элементы списка
+    /// @param keepNodes ```true``` - оставить узлы в запасе для следующих вставок,
+    ///     ```false``` - освободить их вместе с уже запасёнными
+    void clear(bool keepNodes = false);
+
+    /// @brief Запасает узлы так, чтобы ```count``` элементов поместились без выделения памяти
+    /// @details Узлы выделяются сразу, по одному, поэтому остаются независимыми и
+    ///     свободно переходят между списками через ```splice```
+    /// @param count Требуемая ёмкость
+    void reserve(size_t count);
+
+    /// @brief Ёмкость списка
+    /// @details Удалённые элементы оставляют узлы в запасе, и следующие вставки
+    ///     берут узлы оттуда, не обращаясь к аллокатору
+    /// @return Количество элементов вместе с запасными узлами
+    size_t capacity() const;
+
+    /// @brief Освобождает запасные узлы
+    void shrink_to_fit();
 
     /// @brief Проверка на наличие элементов в списке
     /// @return ```true```, если список пустой, иначе ```false```
@@ -259,117 +1015,538 @@ public:
     /// @return Количество элементов списка
     size_t size() const;    
 
+    /// @brief Счётчики статистики списка
+    /// @details Без политики статистики (```NoListStats```) все счётчики нулевые.
+    ///     Общий счёт процесса возвращает ```globalListStats()```
+    /// @return Копия счётчиков
+    ListStats stats() const;
+
+    /// @brief Обнуляет счётчики статистики списка; общий счёт процесса не меняется
+    void reset_stats();
+
     /// @brief Возвращает итератор на первый элемент списка
     /// @return Итератор на первый элемент списка
-    Iterator begin() const;
+    Iterator begin();
+
+    /// @brief Возвращает константный итератор на первый элемент списка
+    /// @return Итератор на первый элемент списка
+    ConstIterator begin() const;
     
     /// @brief Возвращает итератор на последний элемент списка
     /// @return Итератор на последний элемент списка
-    Iterator end() const;
+    Iterator end();
+
+    /// @brief Возвращает константный итератор за последним элементом списка
+    /// @return Итератор за последним элементом списка
+    ConstIterator end() const;
+
+    /// @brief Возвращает константный итератор на первый элемент списка
+    /// @return Итератор на первый элемент списка
+    ConstIterator cbegin() const;
+
+    /// @brief Возвращает константный итератор за последним элементом списка
+    /// @return Итератор за последним элементом списка
+    ConstIterator cend() const;
+
+    /// @brief Возвращает обратный итератор на последний элемент списка
+    /// @return Обратный итератор на последний элемент
+    reverse_iterator rbegin();
+
+    /// @brief Возвращает константный обратный итератор на последний элемент списка
+    /// @return Обратный итератор на последний элемент
+    const_reverse_iterator rbegin() const;
+
+    /// @brief Возвращает обратный итератор перед первым элементом списка
+    /// @return Обратный итератор перед первым элементом
+    reverse_iterator rend();
+
+    /// @brief Возвращает константный обратный итератор перед первым элементом списка
+    /// @return Обратный итератор перед первым элементом
+    const_reverse_iterator rend() const;
+
+    /// @brief Возвращает константный обратный итератор на последний элемент списка
+    /// @return Обратный итератор на последний элемент
+    const_reverse_iterator crbegin() const;
+
+    /// @brief Возвращает константный обратный итератор перед первым элементом списка
+    /// @return Обратный итератор перед первым элементом
+    const_reverse_iterator crend() const;
 };
 
-template <typename T>
-List<T>::List() : head(nullptr), tail(nullptr), _size(0) {}
+/// @brief Список, узлы которого выделяются из ```std::pmr::memory_resource```
+/// @details Удобен для размещения целого списка в ```monotonic_buffer_resource```
+///     или ```unsynchronized_pool_resource```
+template <typename T, typename Stats = NoListStats>
+using PmrList = List<T, std::pmr::polymorphic_allocator<T>, Stats>;
+
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::List() : List(Alloc()) {}
+
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::List(const Alloc& alloc)
+    : _alloc(alloc), head(nullptr), tail(nullptr), _size(0), _blocks(alloc) {}
 
-template <typename T>
-List<T>::List(size_t count, const T& alloc_elem) {
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::List(size_t count, const T& alloc_elem, const Alloc& alloc) : List(alloc) {
     for (size_t i = 0; i < count; ++i) {
         push_back(alloc_elem);
     }
 }
 
-template <typename T>
-List<T>::List(std::initializer_list<T> initList) {
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::List(std::initializer_list<T> initList, const Alloc& alloc) : List(alloc) {
     for (const T& elem : initList) {
         push_back(elem);
     }
 }
 
-template <typename T>
-List<T>::List(typename List<T>::Iterator from, typename List<T>::Iterator to) {
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::List(typename List::ConstIterator from, typename List::ConstIterator to, const Alloc& alloc)
+    : List(alloc) {
     for (auto it = from; it != to; ++it) {
         this->push_back(*it);
     }
 }
 
-template <typename T>
-List<T>::~List()
+template <typename T, typename Alloc, typename Stats>
+template <std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+List<T, Alloc, Stats>::List(from_range_t, R&& range, const Alloc& alloc) : List(alloc) {
+    append_range(std::forward<R>(range));
+}
+
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::~List()
 {
-    Node* current = head;
-    while (current != nullptr) {
-        Node* next = current->nextP;
-        delete current;
-        current = next;
-    }
-    head = tail = nullptr;
-    this->_size = 0;  
+    clear();
 }
 
-template <typename T>
-List<T>::List(const List<T> &other) {
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::List(const List& other)
+    : List(other, ValueAllocTraits::select_on_container_copy_construction(other.get_allocator())) {}
+
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::List(const List& other, const Alloc& alloc) : List(alloc) {
     // std::cout << "copy cons\n";
     if (other._size == 0) {
         return;
     }
-    for (Iterator other_it = other.begin(); other_it != other.end(); ++other_it) {
+    for (ConstIterator other_it = other.begin(); other_it != other.end(); ++other_it) {
         push_back(other_it.node->data);
     }
 }
 
-template <typename T>
-List<T>::List(List<T>&& other) {
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::List(List&& other) noexcept
+    : _alloc(std::move(other._alloc)), _blocks(std::move(other._blocks)) {
     // std::cout << "move cons\n";
     this->head = other.head;
     this->tail = other.tail;
     this->_size = other._size;
+    this->_compactTail = other._compactTail;
+    this->_spare = other._spare;
+    this->_spareCount = other._spareCount;
 
     other.head = nullptr;
     other.tail = nullptr;
     other._size = 0;
+    other._blocks.clear();
+    other._compactTail = nullptr;
+    other._spare = nullptr;
+    other._spareCount = 0;
+}
+
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>::List(List&& other, const Alloc& alloc) : List(alloc) {
+    takeNodes(other);
 }
 
-template <typename T>
-List<T>& List<T>::operator=(const List<T>& other) {
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>& List<T, Alloc, Stats>::operator=(const List& other) {
     // std::cout << "copy operator=\n";
     if (this != &other) {
-        List<T> tmp(other);
-        swapThis(tmp);
+        if constexpr (NodeAllocTraits::propagate_on_container_copy_assignment::value) {
+            if (_alloc != other._alloc) {
+                this->clear();
+            }
+            _alloc = other._alloc;
+        }
+        List tmp(other, get_allocator());
+        replaceWith(tmp);
     }
     return *this;
 }
 
-template <typename T>
-List<T>& List<T>::operator=(List<T>&& other) {
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>& List<T, Alloc, Stats>::operator=(List&& other) noexcept(
+    NodeAllocTraits::propagate_on_container_move_assignment::value ||
+    NodeAllocTraits::is_always_equal::value) {
     // std::cout << "move operator=\n";
     if (this != &other) {
         this->clear();
-
-        this->head = other.head;
-        this->tail = other.tail;
-        this->_size = other._size;
-
-        other.head = nullptr;
-        other.tail = nullptr;
-        other._size = 0;        
+        if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::value) {
+            _alloc = std::move(other._alloc);
+        }
+        takeNodes(other);
     }
     return *this;
 }
 
-template <typename T>
-void List<T>::swapThis(List& copy) {
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::swap(List& other) {
+    if (this == &other) {
+        return;
+    }
+    if constexpr (NodeAllocTraits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(_alloc, other._alloc);
+    }
+    else if (_alloc != other._alloc) {
+        List tmp(std::move(*this), get_allocator());
+        *this = std::move(other);
+        other = std::move(tmp);
+        return;
+    }
+    swapThis(other);
+}
+
+template <typename T, typename Alloc, typename Stats>
+Alloc List<T, Alloc, Stats>::get_allocator() const {
+    return Alloc(_alloc);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::swapThis(List& copy) {
     std::swap(this->head, copy.head);
     std::swap(this->tail, copy.tail);
     std::swap(this->_size, copy._size);
+    std::swap(this->_blocks, copy._blocks);
+    std::swap(this->_compactTail, copy._compactTail);
+    std::swap(this->_spare, copy._spare);
+    std::swap(this->_spareCount, copy._spareCount);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::replaceWith(List& tmp) {
+    swapThis(tmp);
+    tmp.clear();
+    _stats.absorb(tmp.stats());
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::takeNodes(List& other) {
+    if (other.empty()) {
+        return;
+    }
+    if (_alloc == other._alloc) {
+        adoptBlocks(other);
+        Node* first = other.head;
+        Node* last = other.tail;
+        size_t count = other._size;
+        other.unlinkNodes(first, last, count);
+        linkNodesBefore(nullptr, first, last, count);
+    }
+    else {
+        for (Node* node = other.head; node != nullptr; node = node->nextP) {
+            emplace_back(std::move(node->data));
+        }
+        other.clear();
+    }
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::restoreBackLinks() {
+    Node* prev = nullptr;
+    uint64_t relinked = 0;
+    for (Node* node = head; node != nullptr; node = node->nextP) {
+        if constexpr (Stats::enabled) {
+            relinked += node->prevP != prev ? 1 : 0;
+        }
+        node->prevP = prev;
+        prev = node;
+    }
+    tail = prev;
+    _stats.relinked(relinked);
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename... Args>
+typename List<T, Alloc, Stats>::Node* List<T, Alloc, Stats>::createNode(Node* prevP, Node* nextP, Args&&... args) {
+    if (_spare != nullptr) {
+        Node* node = _spare;
+        Alloc valueAlloc(_alloc);
+        ValueAllocTraits::construct(valueAlloc, std::addressof(node->data), std::forward<Args>(args)...);
+        _spare = node->nextP;
+        --_spareCount;
+        node->prevP = prevP;
+        node->nextP = nextP;
+        return node;
+    }
+    Node* node = NodeAllocTraits::allocate(_alloc, 1);
+    ::new (static_cast<void*>(node)) Node(prevP, nextP);
+    try {
+        Alloc valueAlloc(_alloc);
+        ValueAllocTraits::construct(valueAlloc, std::addressof(node->data), std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node->~Node();
+        NodeAllocTraits::deallocate(_alloc, node, 1);
+        throw;
+    }
+    _stats.allocated(sizeof(Node));
+    return node;
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::destroyNode(Node* node) {
+    Alloc valueAlloc(_alloc);
+    ValueAllocTraits::destroy(valueAlloc, std::addressof(node->data));
+    if (node == _compactTail) {
+        _compactTail = nullptr;
+    }
+    node->prevP = nullptr;
+    node->nextP = _spare;
+    _spare = node;
+    ++_spareCount;
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::freeNode(Node* node) {
+    node->~Node();
+    if (!_blocks.empty()) {
+        auto block = findBlock(node);
+        if (block != _blocks.end()) {
+            if (--block->live == 0) {
+                NodeAllocTraits::deallocate(_alloc, block->nodes, block->capacity);
+                _stats.deallocated(block->capacity * sizeof(Node));
+                _blocks.erase(block);
+            }
+            return;
+        }
+    }
+    NodeAllocTraits::deallocate(_alloc, node, 1);
+    _stats.deallocated(sizeof(Node));
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::releaseSpare() {
+    while (_spare != nullptr) {
+        Node* next = _spare->nextP;
+        freeNode(_spare);
+        _spare = next;
+    }
+    _spareCount = 0;
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Blocks::iterator List<T, Alloc, Stats>::findBlock(const Node* node) {
+    std::less<const Node*> less;
+    auto block = std::upper_bound(_blocks.begin(), _blocks.end(), node,
+        [&less](const Node* value, const Block& block) { return less(value, block.nodes); });
+    if (block == _blocks.begin()) {
+        return _blocks.end();
+    }
+    --block;
+    return less(node, block->nodes + block->capacity) ? block : _blocks.end();
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::relocateNodes(Node* first, size_t count) {
+    // место под запись блока резервируется заранее, чтобы регистрация не бросала
+    _blocks.reserve(_blocks.size() + 1);
+    Node* slots = NodeAllocTraits::allocate(_alloc, count);
+    Alloc valueAlloc(_alloc);
+    Node* node = first;
+    size_t moved = 0;
+
+    try {
+        for (; moved < count; ++moved) {
+            Node* slot = slots + moved;
+            ::new (static_cast<void*>(slot)) Node(node->prevP, node->nextP);
+            try {
+                ValueAllocTraits::construct(valueAlloc, std::addressof(slot->data), std::move_if_noexcept(node->data));
+            }
+            catch (...) {
+                slot->~Node();
+                throw;
+            }
+            if (slot->prevP != nullptr) {
+                slot->prevP->nextP = slot;
+            }
+            else {
+                head = slot;
+            }
+            if (slot->nextP != nullptr) {
+                slot->nextP->prevP = slot;
+            }
+            else {
+                tail = slot;
+            }
+            Node* next = node->nextP;
+            ValueAllocTraits::destroy(valueAlloc, std::addressof(node->data));
+            if (node == _compactTail) {
+                _compactTail = nullptr;
+            }
+            freeNode(node);
+            node = next;
+        }
+    }
+    catch (...) {
+        insertBlock(slots, count, moved);
+        throw;
+    }
+    insertBlock(slots, count, moved);
+    _compactTail = slots + count - 1;
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::insertBlock(Node* nodes, size_t capacity, size_t live) {
+    if (live == 0) {
+        NodeAllocTraits::deallocate(_alloc, nodes, capacity);
+        return;
+    }
+    _stats.allocated(capacity * sizeof(Node));
+    std::less<const Node*> less;
+    auto pos = std::upper_bound(_blocks.begin(), _blocks.end(), nodes,
+        [&less](const Node* value, const Block& block) { return less(value, block.nodes); });
+    _blocks.insert(pos, Block{nodes, capacity, live});
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::appendBlock(const unsigned char* bytes, size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    _blocks.reserve(_blocks.size() + 1);
+    Node* slots = NodeAllocTraits::allocate(_alloc, count);
+    for (size_t i = 0; i < count; ++i) {
+        Node* slot = ::new (static_cast<void*>(slots + i)) Node(
+            i == 0 ? nullptr : slots + i - 1, i + 1 == count ? nullptr : slots + i + 1);
+        std::memcpy(static_cast<void*>(std::addressof(slot->data)), bytes + i * sizeof(T), sizeof(T));
+    }
+    insertBlock(slots, count, count);
+    linkNodesBefore(nullptr, slots, slots + count - 1, count);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::adoptBlocks(List& other) {
+    if (other._blocks.empty()) {
+        return;
+    }
+    if (_blocks.empty()) {
+        std::swap(_blocks, other._blocks);
+    }
+    else {
+        size_t middle = _blocks.size();
+        _blocks.insert(_blocks.end(), other._blocks.begin(), other._blocks.end());
+        std::inplace_merge(_blocks.begin(), _blocks.begin() + middle, _blocks.end(),
+            [](const Block& left, const Block& right) {
+                return std::less<const Node*>()(left.nodes, right.nodes);
+            });
+        other._blocks.clear();
+    }
+    other._compactTail = nullptr;
+    // запасные узлы other могут лежать в забранных блоках, поэтому уходят вместе с ними
+    if (other._spare != nullptr) {
+        Node* last = other._spare;
+        while (last->nextP != nullptr) {
+            last = last->nextP;
+        }
+        last->nextP = _spare;
+        _spare = std::exchange(other._spare, nullptr);
+        _spareCount += std::exchange(other._spareCount, 0);
+    }
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::linkBefore(Node* next, Node* node) {
+    linkNodesBefore(next, node, node, 1);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::linkNodesBefore(Node* next, Node* first, Node* last, size_t count) {
+    Node* prev = next != nullptr ? next->prevP : tail;
+    first->prevP = prev;
+    last->nextP = next;
+
+    if (prev != nullptr) {
+        prev->nextP = first;
+    }
+    else {
+        head = first;
+    }
+    if (next != nullptr) {
+        next->prevP = last;
+    }
+    else {
+        tail = last;
+    }
+    _size += count;
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::unlinkNodes(Node* first, Node* last, size_t count) {
+    if (first->prevP != nullptr) {
+        first->prevP->nextP = last->nextP;
+    }
+    else {
+        head = last->nextP;
+    }
+    if (last->nextP != nullptr) {
+        last->nextP->prevP = first->prevP;
+    }
+    else {
+        tail = first->prevP;
+    }
+    first->prevP = nullptr;
+    last->nextP = nullptr;
+    _size -= count;
+}
+
+template <typename T, typename Alloc, typename Stats>
+size_t List<T, Alloc, Stats>::destroyNodes(Node* first) {
+    size_t count = 0;
+    while (first != nullptr) {
+        Node* next = first->nextP;
+        destroyNode(first);
+        first = next;
+        ++count;
+    }
+    return count;
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename InputIt, typename Sentinel>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::insertNodes(ConstIterator pos, InputIt first, Sentinel last) {
+    // цепочка собирается узлами текущего списка, чтобы выделения попали в его статистику
+    Node* chainFirst = nullptr;
+    Node* chainLast = nullptr;
+    size_t count = 0;
+    try {
+        for (; first != last; ++first) {
+            Node* node = createNode(chainLast, nullptr, *first);
+            (chainLast != nullptr ? chainLast->nextP : chainFirst) = node;
+            chainLast = node;
+            ++count;
+        }
+    }
+    catch (...) {
+        destroyNodes(chainFirst);
+        throw;
+    }
+    if (count == 0) {
+        return Iterator(pos.node, this);
+    }
+    linkNodesBefore(pos.node, chainFirst, chainLast, count);
+    return Iterator(chainFirst, this);
 }
 
-template <typename T>
-List<T>& List<T>::operator=(std::initializer_list<T> initList) {
-    *this = List<T>(initList);
+template <typename T, typename Alloc, typename Stats>
+List<T, Alloc, Stats>& List<T, Alloc, Stats>::operator=(std::initializer_list<T> initList) {
+    *this = List(initList, get_allocator());
     return *this;
 }
 
-template <typename T>
-bool List<T>::operator==(const List& other) const {
+template <typename T, typename Alloc, typename Stats>
+bool List<T, Alloc, Stats>::operator==(const List& other) const {
     if (this == &other) return true;
     if (size() != other.size()) return false;
     if (size() == 0 && other.size() == 0) return true;
@@ -386,57 +1563,80 @@ bool List<T>::operator==(const List& other) const {
     return true;
 }
 
-template <typename T>
-bool List<T>::operator!=(const List& other) const {
+template <typename T, typename Alloc, typename Stats>
+bool List<T, Alloc, Stats>::operator!=(const List& other) const {
     return !(*this == other); 
 }
-template <typename T>
-T List<T>::front() const {
+template <typename T, typename Alloc, typename Stats>
+T& List<T, Alloc, Stats>::front() {
+    if (!head) {
+        throw std::out_of_range("List is empty!");
+    }
+    return head->data;
+}
+
+template <typename T, typename Alloc, typename Stats>
+const T& List<T, Alloc, Stats>::front() const {
     if (!head) {
         throw std::out_of_range("List is empty!");
     }
     return head->data;
 }
 
-template <typename T>
-T List<T>::back() const {
+template <typename T, typename Alloc, typename Stats>
+T& List<T, Alloc, Stats>::back() {
     if (!tail) {
         throw std::out_of_range("List is empty!");  
     }
     return tail->data;
 }
 
-template <typename T>
-void List<T>::push_front(const T& data) {
-    Node* new_node = new Node(data, nullptr, head);
-
-    if (tail == nullptr) {
-        tail = new_node;
-    }
-    else {
-        head->prevP = new_node;
+template <typename T, typename Alloc, typename Stats>
+const T& List<T, Alloc, Stats>::back() const {
+    if (!tail) {
+        throw std::out_of_range("List is empty!");  
     }
-    head = new_node;
-    _size++;
+    return tail->data;
 }
 
-template <typename T>
-void List<T>::push_back(const T& data) {
-    Node* new_node = new Node(data, tail);
-    
-    if (head == nullptr) {
-        head = new_node;
-    }    
-    else {
-        tail->nextP = new_node;
-    }
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::push_front(T&& data) {
+    emplace_front(std::move(data));
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename... Args>
+T& List<T, Alloc, Stats>::emplace_front(Args&&... args) {
+    Node* new_node = createNode(nullptr, head, std::forward<Args>(args)...);
+    linkBefore(head, new_node);
+    return new_node->data;
+}
 
-    tail = new_node;
-    this->_size++;
+template <typename T, typename Alloc, typename Stats>
+template <typename... Args>
+T& List<T, Alloc, Stats>::emplace_back(Args&&... args) {
+    Node* new_node = createNode(tail, nullptr, std::forward<Args>(args)...);
+    linkBefore(nullptr, new_node);
+    return new_node->data;
 }
 
-template <typename T>
-void List<T>::pop_front() {
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::pop_front() {
     if (!empty()) {
         erase(begin());
     }
@@ -445,44 +1645,91 @@ void List<T>::pop_front() {
     }
 }
 
-template <typename T>
-void List<T>::pop_back() {
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::pop_front(T& out) {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    out = std::move(head->data);
+    erase(begin());
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::pop_back() {
     if (!empty()) {
-        erase(Iterator{tail});
+        erase(Iterator(tail, this));
     }
     else {
         throw std::out_of_range("List is empty!");
     }
 }
 
-template <typename T>
-void List<T>::insert(const Iterator& pos, const T& value) {
-    if (pos == begin()) {
-        push_front(value);
-    }
-    else if (pos == end()) {
-        push_back(value);
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::pop_back(T& out) {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
     }
-    else {
-        Iterator prev_node_iter = pos-1;
-        Iterator next_node_iter = pos;
+    out = std::move(tail->data);
+    erase(Iterator(tail, this));
+}
 
-        Node* new_node = new Node(value, prev_node_iter.node, next_node_iter.node);
-        prev_node_iter.node->nextP = new_node;
-        next_node_iter.node->prevP = new_node;
-        _size++;
-    }
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::insert(ConstIterator pos, const T& value) {
+    return emplace(pos, value);
 }
 
-template <typename T>
-void List<T>::insert(const Iterator& pos, std::initializer_list<T> initList) {
-    for (size_t i = 0; i < initList.size(); ++i) {
-        insert(pos, *(initList.begin() + i));
-    }
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::insert(ConstIterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename... Args>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::emplace(ConstIterator pos, Args&&... args) {
+    Node* new_node = createNode(nullptr, pos.node, std::forward<Args>(args)...);
+    linkBefore(pos.node, new_node);
+    return Iterator(new_node, this);
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::insert(ConstIterator pos, std::initializer_list<T> initList) {
+    return insert(pos, initList.begin(), initList.end());
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::insert(ConstIterator pos, size_t count, const T& value) {
+    auto copies = std::views::iota(size_t{0}, count)
+        | std::views::transform([&value](size_t) -> const T& { return value; });
+    return insertNodes(pos, copies.begin(), copies.end());
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename InputIt, typename>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::insert(ConstIterator pos, InputIt first, InputIt last) {
+    return insertNodes(pos, first, last);
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::insert(ConstIterator pos, std::span<const T> values) {
+    return insert(pos, values.begin(), values.end());
 }
 
-template <typename T>
-typename List<T>::Iterator List<T>::erase(const Iterator& pos) {
+template <typename T, typename Alloc, typename Stats>
+template <std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::insert_range(ConstIterator pos, R&& range) {
+    return insertNodes(pos, std::ranges::begin(range), std::ranges::end(range));
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+void List<T, Alloc, Stats>::append_range(R&& range) {
+    insert_range(end(), std::forward<R>(range));
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::erase(ConstIterator pos) {
     if (empty()) {
         throw std::out_of_range("Trying to erase in empty list!");
     }
@@ -503,9 +1750,9 @@ typename List<T>::Iterator List<T>::erase(const Iterator& pos) {
         else {
             tail = node->prevP;
         }
-        Iterator next_iter = Iterator(node->nextP);
+        Iterator next_iter = Iterator(node->nextP, this);
 
-        delete node;
+        destroyNode(node);
         _size--;
         return next_iter;
     }
@@ -514,53 +1761,307 @@ typename List<T>::Iterator List<T>::erase(const Iterator& pos) {
     }
 }
 
-template <typename T>
-typename List<T>::Iterator List<T>::erase(const Iterator& first, const Iterator& last) {
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::erase(ConstIterator first, ConstIterator last) {
     if (empty()) {
         throw std::out_of_range("Trying to erase in empty list!");
     }
-    Iterator it = first;
-    while (it != last) {
-        it = erase(it);        
+    if (first == last) {
+        return Iterator(last.node, this);
+    }
+    Node* lastNode = last.node != nullptr ? last.node->prevP : tail;
+    unlinkNodes(first.node, lastNode, 0);
+    _size -= destroyNodes(first.node);
+    return Iterator(last.node, this);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::splice(ConstIterator pos, List& other) {
+    if (this == &other || other.empty()) {
+        return;
+    }
+    splice(pos, other, other.begin(), other.end(), other._size);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::splice(ConstIterator pos, List&& other) {
+    splice(pos, other);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::splice(ConstIterator pos, List& other, ConstIterator it) {
+    if (it.node == nullptr) {
+        throw std::out_of_range("Invalid splicing");
+    }
+    splice(pos, other, it, ConstIterator(it.node->nextP, &other), 1);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::splice(ConstIterator pos, List&& other, ConstIterator it) {
+    splice(pos, other, it);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::splice(ConstIterator pos, List& other, ConstIterator first, ConstIterator last) {
+    size_t count = 0;
+    if (this != &other) {
+        for (ConstIterator it = first; it != last; ++it) {
+            ++count;
+        }
+    }
+    splice(pos, other, first, last, count);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::splice(ConstIterator pos, List&& other, ConstIterator first, ConstIterator last) {
+    splice(pos, other, first, last);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::splice(ConstIterator pos, List& other, ConstIterator first, ConstIterator last, size_t count) {
+    if (first == last || (this == &other && (pos == first || pos == last))) {
+        return;
+    }
+    _stats.spliced();
+    // узлы из блоков compact и load не могут уйти в другой список поодиночке;
+    // целиком список уходит вместе со своими блоками
+    bool wholeList = first.node == other.head && last.node == nullptr;
+    if (_alloc != other._alloc || (this != &other && !other._blocks.empty() && !wholeList)) {
+        for (ConstIterator it = first; it != last; ++it) {
+            emplace(pos, std::move(it.node->data));
+        }
+        other.erase(first, last);
+        return;
+    }
+    if (this != &other) {
+        adoptBlocks(other);
     }
-    return it;
+    Node* firstNode = first.node;
+    Node* lastNode = last.node != nullptr ? last.node->prevP : other.tail;
+
+    // внутри одного списка размер не меняется, поэтому узлы не пересчитываются
+    size_t moved = this != &other ? count : 0;
+    other.unlinkNodes(firstNode, lastNode, moved);
+    linkNodesBefore(pos.node, firstNode, lastNode, moved);
 }
 
-template <typename T>
-void List<T>::merge(const List<T>& other) {
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::merge(const List& other) {
     if (this != &other) {
-        List<T> tmp(other);
+        List tmp(other, get_allocator());
         merge(std::move(tmp));
     }
 }
 
-template <typename T>
-void List<T>::merge(List<T>&& other) {
-    if (!this->empty()) {
-        this->tail->nextP = other.head;
-        other.head->prevP = this->tail;
-        this->tail = other.tail;
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::merge(List&& other) {
+    _stats.merged();
+    splice(end(), other);
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Compare>
+void List<T, Alloc, Stats>::merge(List& other, Compare comp) {
+    if (this == &other || other.empty()) {
+        return;
+    }
+    if (_alloc != other._alloc) {
+        List moved(get_allocator());
+        moved.takeNodes(other);
+        merge(moved, std::move(comp));
+        return;
+    }
+    _stats.merged();
+    adoptBlocks(other);
+    Node* left = head;
+    Node* leftTail = tail;
+    Node* right = other.head;
+    Node* rightTail = other.tail;
+    size_t count = other._size;
+    other.unlinkNodes(right, rightTail, count);
+    _size += count;
+
+    // обратные связи ставятся по ходу слияния; остаток одной из цепочек уже связан
+    Node** link = &head;
+    Node* prev = nullptr;
+    uint64_t compared = 0;
+    uint64_t relinked = 0;
+    auto take = [&link, &prev, &relinked](Node*& from) {
+        Node* node = from;
+        from = node->nextP;
+        if constexpr (Stats::enabled) {
+            relinked += node->prevP != prev ? 1 : 0;
+        }
+        node->prevP = prev;
+        *link = node;
+        link = &node->nextP;
+        prev = node;
+    };
+    try {
+        while (left != nullptr && right != nullptr) {
+            if constexpr (Stats::enabled) {
+                ++compared;
+            }
+            if (comp(std::as_const(right->data), std::as_const(left->data))) {
+                take(right);
+            }
+            else {
+                take(left);
+            }
+        }
+    }
+    catch (...) {
+        // необработанные узлы обеих цепочек дописываются в конец, чтобы ничего не потерять
+        if (left != nullptr) {
+            *link = left;
+            left->prevP = prev;
+            prev = leftTail;
+            link = &leftTail->nextP;
+        }
+        *link = right;
+        if (right != nullptr) {
+            right->prevP = prev;
+            prev = rightTail;
+        }
+        tail = prev;
+        _stats.compared(compared);
+        _stats.relinked(relinked);
+        throw;
+    }
+    Node* rest = left != nullptr ? left : right;
+    *link = rest;
+    if (rest != nullptr) {
+        if constexpr (Stats::enabled) {
+            relinked += rest->prevP != prev ? 1 : 0;
+        }
+        rest->prevP = prev;
+        tail = left != nullptr ? leftTail : rightTail;
     }
     else {
-        this->head = other.head;
-        this->tail = other.tail;
+        tail = prev;
     }
+    _stats.compared(compared);
+    _stats.relinked(relinked);
+}
 
-    this->_size += other._size;        
+template <typename T, typename Alloc, typename Stats>
+template <typename Compare>
+void List<T, Alloc, Stats>::merge(List&& other, Compare comp) {
+    merge(other, std::move(comp));
+}
 
-    other._size = 0;
-    other.head = other.tail = nullptr;
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::sort() {
+    sort(std::less<T>());
 }
 
-template <typename T>
-void List<T>::sort() {
-    if (!empty()) {
-        *this = mergeSort(*this);
+template <typename T, typename Alloc, typename Stats>
+template <typename Compare, typename>
+void List<T, Alloc, Stats>::sort(Compare comp) {
+    if constexpr (radixDirection<Compare> != 0) {
+        if (_size >= radixSortThreshold) {
+            if constexpr (radixDirection<Compare> > 0) {
+                radixSort([](const T& value) { return radixKey(value); });
+            }
+            else {
+                radixSort([](const T& value) { return decltype(radixKey(value))(~radixKey(value)); });
+            }
+            return;
+        }
+    }
+    sort(1, std::move(comp));
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename KeyOf>
+void List<T, Alloc, Stats>::sort_by_key(KeyOf key) {
+    using Key = std::decay_t<std::invoke_result_t<KeyOf&, const T&>>;
+    if constexpr (isRadixKey<Key>) {
+        if (_size >= radixSortThreshold) {
+            radixSort([&key](const T& value) { return radixKey(static_cast<Key>(key(value))); });
+            return;
+        }
+    }
+    sort(1, [&key](const T& left, const T& right) { return key(left) < key(right); });
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename KeyOf>
+void List<T, Alloc, Stats>::radixSort(KeyOf key) {
+    std::vector<Node*> order;
+    order.reserve(_size);
+    radixSortNodes(head, order, [&key](const Node* node) { return key(std::as_const(node->data)); });
+    Node* prev = nullptr;
+    uint64_t relinked = 0;
+    for (Node* node : order) {
+        if constexpr (Stats::enabled) {
+            relinked += node->prevP != prev ? 1 : 0;
+        }
+        node->prevP = prev;
+        if (prev != nullptr) {
+            prev->nextP = node;
+        }
+        else {
+            head = node;
+        }
+        prev = node;
+    }
+    prev->nextP = nullptr;
+    tail = prev;
+    _stats.relinked(relinked);
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename ExecutionPolicy, typename Compare, typename>
+void List<T, Alloc, Stats>::sort(ExecutionPolicy&&, Compare comp) {
+    size_t threads = 1;
+    // hardware_concurrency читает файлы системы, поэтому для малых списков не вызывается
+    if constexpr (ListExecutionPolicy<std::decay_t<ExecutionPolicy>>::parallel) {
+        if (_size >= parallelSortThreshold) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+    }
+    sort(threads, std::move(comp));
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Compare>
+void List<T, Alloc, Stats>::sort(size_t threads, Compare comp, size_t threshold) {
+    if (_size < 2) {
+        return;
+    }
+    // задачи параллельной сортировки сравнивают одновременно, поэтому счётчик атомарный
+    std::atomic<uint64_t> compared{0};
+    auto nodeComp = [comp, &compared](const Node* left, const Node* right) mutable {
+        if constexpr (Stats::enabled) {
+            compared.fetch_add(1, std::memory_order_relaxed);
+        }
+        return comp(left->data, right->data);
+    };
+    auto countComparisons = [this, &compared]() {
+        if constexpr (Stats::enabled) {
+            _stats.compared(compared.load(std::memory_order_relaxed));
+        }
+    };
+    try {
+        if (threads > 1 && _size >= threshold) {
+            sortNodesParallel(head, _size, nodeComp, threads);
+        }
+        else {
+            sortNodes(head, nodeComp);
+        }
+    }
+    catch (...) {
+        countComparisons();
+        restoreBackLinks();
+        throw;
     }
+    countComparisons();
+    restoreBackLinks();
 }
 
-template <typename T>
-void List<T>::reverse() {
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::reverse() {
     if (!empty()) {
         Node* current = head;
         while (current != nullptr) {
@@ -571,73 +2072,554 @@ void List<T>::reverse() {
     }
 }
 
-template <typename T>
-void List<T>::clear() {
-    if (!empty()) {
-        erase(begin(), end());
-        if (_size != 0) {
-            _size = 0;
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::prefetchNode(const Node* node) {
+#if defined(__GNUC__) || defined(__clang__)
+    const char* bytes = reinterpret_cast<const char*>(node);
+    for (size_t offset = 0; offset < sizeof(Node); offset += prefetchStride) {
+        __builtin_prefetch(bytes + offset);
+    }
+#else
+    (void)node;
+#endif
+}
+
+template <typename T, typename Alloc, typename Stats>
+size_t List<T, Alloc, Stats>::gatherBatch(Node*& node, Node** batch) {
+    size_t count = 0;
+    for (; node != nullptr && count < scanBatch; node = node->nextP) {
+        prefetchNode(node);
+        batch[count++] = node;
+    }
+    return count;
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Visit>
+typename List<T, Alloc, Stats>::Node* List<T, Alloc, Stats>::scanNodes(Visit visit) const {
+    Node* batches[2][scanBatch];
+    Node* next = head;
+    size_t count = gatherBatch(next, batches[0]);
+    for (size_t curr = 0; count != 0; curr ^= 1) {
+        size_t nextCount = gatherBatch(next, batches[curr ^ 1]);
+        size_t stop = visit(static_cast<Node* const*>(batches[curr]), count);
+        if (stop < count) {
+            return batches[curr][stop];
         }
+        count = nextCount;
     }
+    return nullptr;
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Fn>
+Fn List<T, Alloc, Stats>::for_each(Fn fn) {
+    scanNodes([&fn](Node* const* batch, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(batch[i]->data);
+        }
+        return count;
+    });
+    return fn;
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Fn>
+Fn List<T, Alloc, Stats>::for_each(Fn fn) const {
+    scanNodes([&fn](Node* const* batch, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(std::as_const(batch[i]->data));
+        }
+        return count;
+    });
+    return fn;
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::find(const T& value) {
+    return Iterator(std::as_const(*this).find(value).node, this);
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::ConstIterator List<T, Alloc, Stats>::find(const T& value) const {
+    Node* found = scanNodes([&value](Node* const* batch, size_t count) -> size_t {
+        if constexpr (gatherValues) {
+            // полная пачка сравнивается циклом постоянной длины, лишние места маскируются
+            T values[scanBatch] = {};
+            for (size_t i = 0; i < count; ++i) {
+                values[i] = batch[i]->data;
+            }
+            unsigned mask = 0;
+            for (size_t i = 0; i < scanBatch; ++i) {
+                mask |= static_cast<unsigned>(values[i] == value) << i;
+            }
+            mask &= (1u << count) - 1;
+            return mask != 0 ? static_cast<size_t>(std::countr_zero(mask)) : count;
+        }
+        else {
+            for (size_t i = 0; i < count; ++i) {
+                if (batch[i]->data == value) {
+                    return i;
+                }
+            }
+            return count;
+        }
+    });
+    return ConstIterator(found, this);
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Pred>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::find_if(Pred pred) {
+    return Iterator(std::as_const(*this).find_if(std::move(pred)).node, this);
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Pred>
+typename List<T, Alloc, Stats>::ConstIterator List<T, Alloc, Stats>::find_if(Pred pred) const {
+    Node* found = scanNodes([&pred](Node* const* batch, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            if (pred(std::as_const(batch[i]->data))) {
+                return i;
+            }
+        }
+        return count;
+    });
+    return ConstIterator(found, this);
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Pred>
+size_t List<T, Alloc, Stats>::count_if(Pred pred) const {
+    size_t total = 0;
+    scanNodes([&pred, &total](Node* const* batch, size_t count) {
+        if constexpr (gatherValues) {
+            T values[scanBatch] = {};
+            for (size_t i = 0; i < count; ++i) {
+                values[i] = batch[i]->data;
+            }
+            size_t hits = 0;
+            for (size_t i = 0; i < count; ++i) {
+                hits += pred(std::as_const(values[i])) ? 1 : 0;
+            }
+            total += hits;
+        }
+        else {
+            for (size_t i = 0; i < count; ++i) {
+                total += pred(std::as_const(batch[i]->data)) ? 1 : 0;
+            }
+        }
+        return count;
+    });
+    return total;
 }
 
-template <typename T>
-bool List<T>::empty() const {
+template <typename T, typename Alloc, typename Stats>
+template <typename U, typename BinaryOp>
+U List<T, Alloc, Stats>::accumulate(U init, BinaryOp op) const {
+    scanNodes([&init, &op](Node* const* batch, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            init = op(std::move(init), std::as_const(batch[i]->data));
+        }
+        return count;
+    });
+    return init;
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Pred>
+size_t List<T, Alloc, Stats>::remove_if(Pred pred) {
+    Node* removed = nullptr;
+    Node** link = &removed;
+    size_t total = 0;
+    try {
+        scanNodes([this, &pred, &link, &total](Node* const* batch, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                Node* node = batch[i];
+                if (pred(std::as_const(node->data))) {
+                    unlinkNodes(node, node, 1);
+                    *link = node;
+                    link = &node->nextP;
+                    ++total;
+                }
+            }
+            return count;
+        });
+    }
+    catch (...) {
+        destroyNodes(removed);
+        throw;
+    }
+    destroyNodes(removed);
+    return total;
+}
+
+template <typename T, typename Alloc, typename Stats>
+size_t List<T, Alloc, Stats>::remove(const T& value) {
+    return remove_if([&value](const T& data) { return data == value; });
+}
+
+template <typename T, typename Alloc, typename Stats>
+size_t List<T, Alloc, Stats>::unique() {
+    return unique(std::equal_to<T>());
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename BinaryPred>
+size_t List<T, Alloc, Stats>::unique(BinaryPred pred) {
+    Node* removed = nullptr;
+    Node** link = &removed;
+    Node* kept = nullptr;
+    size_t total = 0;
+    try {
+        scanNodes([this, &pred, &link, &kept, &total](Node* const* batch, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                Node* node = batch[i];
+                if (kept != nullptr && pred(std::as_const(kept->data), std::as_const(node->data))) {
+                    unlinkNodes(node, node, 1);
+                    *link = node;
+                    link = &node->nextP;
+                    ++total;
+                }
+                else {
+                    kept = node;
+                }
+            }
+            return count;
+        });
+    }
+    catch (...) {
+        destroyNodes(removed);
+        throw;
+    }
+    destroyNodes(removed);
+    return total;
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Pred>
+List<T, Alloc, Stats> List<T, Alloc, Stats>::partition(Pred pred) {
+    return partition(std::move(pred), get_allocator());
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <typename Pred>
+List<T, Alloc, Stats> List<T, Alloc, Stats>::partition(Pred pred, const Alloc& alloc) {
+    List rejected(alloc);
+    bool relink = _alloc == rejected._alloc && _blocks.empty();
+    Node* removed = nullptr;
+    Node** link = &removed;
+    try {
+        scanNodes([this, &pred, &rejected, relink, &link](Node* const* batch, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                Node* node = batch[i];
+                if (pred(std::as_const(node->data))) {
+                    continue;
+                }
+                if (relink) {
+                    unlinkNodes(node, node, 1);
+                    rejected.linkNodesBefore(nullptr, node, node, 1);
+                }
+                else {
+                    rejected.emplace_back(std::move(node->data));
+                    unlinkNodes(node, node, 1);
+                    *link = node;
+                    link = &node->nextP;
+                }
+            }
+            return count;
+        });
+    }
+    catch (...) {
+        destroyNodes(removed);
+        splice(end(), rejected);
+        throw;
+    }
+    destroyNodes(removed);
+    return rejected;
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::compact() {
+    if (_size != 0) {
+        relocateNodes(head, _size);
+    }
+}
+
+template <typename T, typename Alloc, typename Stats>
+bool List<T, Alloc, Stats>::compact(std::chrono::nanoseconds budget) {
+    auto deadline = std::chrono::steady_clock::now() + budget;
+    do {
+        Node* first = _compactTail != nullptr ? _compactTail->nextP : head;
+        if (first == nullptr) {
+            _compactTail = nullptr;
+            return true;
+        }
+        size_t count = 1;
+        for (Node* node = first->nextP; node != nullptr && count < compactChunk; node = node->nextP) {
+            ++count;
+        }
+        relocateNodes(first, count);
+    } while (std::chrono::steady_clock::now() < deadline);
+    if (_compactTail->nextP == nullptr) {
+        _compactTail = nullptr;
+        return true;
+    }
+    return false;
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::save(std::ostream& out) const {
+    StreamHeader header{streamMagic, static_cast<uint32_t>(sizeof(T)), _size};
+    writeBytes(out, &header, sizeof(header));
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        constexpr size_t chunk = std::max<size_t>(1, ioChunkBytes / sizeof(T));
+        std::vector<unsigned char> buffer(chunk * sizeof(T));
+        uint32_t filled = 0;
+        auto flush = [&out, &buffer, &filled]() {
+            writeBytes(out, &filled, sizeof(filled));
+            writeBytes(out, buffer.data(), filled * sizeof(T));
+            filled = 0;
+        };
+        for_each([&](const T& value) {
+            std::memcpy(buffer.data() + filled * sizeof(T), static_cast<const void*>(std::addressof(value)), sizeof(T));
+            if (++filled == chunk) {
+                flush();
+            }
+        });
+        if (filled != 0) {
+            flush();
+        }
+    }
+    else {
+        for_each([&out](const T& value) { ListSerializer<T>::save(out, value); });
+    }
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::save(int fd) const {
+    FdStreamBuf buffer(fd);
+    std::ostream out(&buffer);
+    out.exceptions(std::ios::badbit);
+    save(out);
+    out.flush();
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::load(std::istream& in) {
+    StreamHeader header{};
+    readBytes(in, &header, sizeof(header));
+    if (header.magic != streamMagic || header.elementSize != sizeof(T)) {
+        throw std::runtime_error("Invalid list stream");
+    }
+    List tmp(get_allocator());
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        constexpr size_t chunk = std::max<size_t>(1, ioChunkBytes / sizeof(T));
+        std::vector<unsigned char> buffer;
+        for (uint64_t left = header.count; left > 0;) {
+            uint32_t count = 0;
+            readBytes(in, &count, sizeof(count));
+            if (count == 0 || count > left) {
+                throw std::runtime_error("Invalid list stream");
+            }
+            left -= count;
+            // порция другой сборки может быть больше своей; читаем её по частям
+            while (count > 0) {
+                size_t part = std::min<size_t>(count, chunk);
+                buffer.resize(part * sizeof(T));
+                readBytes(in, buffer.data(), buffer.size());
+                tmp.appendBlock(buffer.data(), part);
+                count -= static_cast<uint32_t>(part);
+            }
+        }
+    }
+    else {
+        for (uint64_t i = 0; i < header.count; ++i) {
+            tmp.emplace_back(ListSerializer<T>::load(in));
+        }
+    }
+    replaceWith(tmp);
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::load(int fd) {
+    FdStreamBuf buffer(fd);
+    std::istream in(&buffer);
+    in.exceptions(std::ios::badbit);
+    load(in);
+}
+
+template <typename T, typename Alloc, typename Stats>
+ListStats List<T, Alloc, Stats>::stats() const {
+    return _stats.stats();
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::reset_stats() {
+    _stats.reset();
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::clear(bool keepNodes) {
+    Node* first = head;
+    head = tail = nullptr;
+    _size = 0;
+    destroyNodes(first);
+    if (!keepNodes) {
+        releaseSpare();
+    }
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::reserve(size_t count) {
+    for (size_t have = capacity(); have < count; ++have) {
+        Node* node = NodeAllocTraits::allocate(_alloc, 1);
+        ::new (static_cast<void*>(node)) Node(nullptr, _spare);
+        _stats.allocated(sizeof(Node));
+        _spare = node;
+        ++_spareCount;
+    }
+}
+
+template <typename T, typename Alloc, typename Stats>
+size_t List<T, Alloc, Stats>::capacity() const {
+    return _size + _spareCount;
+}
+
+template <typename T, typename Alloc, typename Stats>
+void List<T, Alloc, Stats>::shrink_to_fit() {
+    releaseSpare();
+}
+
+template <typename T, typename Alloc, typename Stats>
+bool List<T, Alloc, Stats>::empty() const {
     return this->_size == 0;
 }
 
-template <typename T>
-size_t List<T>::size() const {
+template <typename T, typename Alloc, typename Stats>
+size_t List<T, Alloc, Stats>::size() const {
     return this->_size;
 }
 
-template <typename T>
-typename List<T>::Iterator List<T>::begin() const {
-    return Iterator(head);
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::begin() {
+    return Iterator(head, this);
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::ConstIterator List<T, Alloc, Stats>::begin() const {
+    return ConstIterator(head, this);
 }
 
-template <typename T>
-typename List<T>::Iterator List<T>::end() const {
-    return Iterator(nullptr);
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::Iterator List<T, Alloc, Stats>::end() {
+    return Iterator(nullptr, this);
 }
 
-template <typename T>
-typename List<T>::Iterator List<T>::Iterator::operator+(size_t shift) const {
-    Iterator curr_it = *this;
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::ConstIterator List<T, Alloc, Stats>::end() const {
+    return ConstIterator(nullptr, this);
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::ConstIterator List<T, Alloc, Stats>::cbegin() const {
+    return begin();
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::ConstIterator List<T, Alloc, Stats>::cend() const {
+    return end();
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::reverse_iterator List<T, Alloc, Stats>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::const_reverse_iterator List<T, Alloc, Stats>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::reverse_iterator List<T, Alloc, Stats>::rend() {
+    return reverse_iterator(begin());
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::const_reverse_iterator List<T, Alloc, Stats>::rend() const {
+    return const_reverse_iterator(begin());
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::const_reverse_iterator List<T, Alloc, Stats>::crbegin() const {
+    return rbegin();
+}
+
+template <typename T, typename Alloc, typename Stats>
+typename List<T, Alloc, Stats>::const_reverse_iterator List<T, Alloc, Stats>::crend() const {
+    return rend();
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+typename List<T, Alloc, Stats>::template BasicIterator<IsConst>
+List<T, Alloc, Stats>::BasicIterator<IsConst>::operator+(size_t shift) const {
+    BasicIterator curr_it = *this;
     for (size_t i = 0; i < shift; ++i) {
-        if (node->nextP != nullptr) {
+        if (curr_it.node != nullptr) {
             curr_it.node = curr_it.node->nextP;
         }
         else {
+            if (owner != nullptr) {
+                owner->_stats.walked(i);
+            }
             throw std::out_of_range("Iterating+ out of range");
         }
     }
+    if (owner != nullptr) {
+        owner->_stats.walked(shift);
+    }
     return curr_it;
 }
 
-template <typename T>
-typename List<T>::Iterator List<T>::Iterator::operator-(size_t shift) const {
-    Iterator curr_it = *this;
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+typename List<T, Alloc, Stats>::template BasicIterator<IsConst>
+List<T, Alloc, Stats>::BasicIterator<IsConst>::operator-(size_t shift) const {
+    BasicIterator curr_it = *this;
     for (size_t i = 0; i < shift; ++i) {
-        if (node->prevP != nullptr) {
-            curr_it.node = curr_it.node->prevP;
+        Node* prev = curr_it.node != nullptr ? curr_it.node->prevP
+                   : (owner != nullptr ? owner->tail : nullptr);
+        if (prev != nullptr) {
+            curr_it.node = prev;
         }
         else {
+            if (owner != nullptr) {
+                owner->_stats.walked(i);
+            }
             throw std::out_of_range("Iterating- out of range");
         }
     }
+    if (owner != nullptr) {
+        owner->_stats.walked(shift);
+    }
     return curr_it;
 }
 
-template <typename T>
-typename List<T>::Iterator& List<T>::Iterator::operator++() {
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+typename List<T, Alloc, Stats>::template BasicIterator<IsConst>&
+List<T, Alloc, Stats>::BasicIterator<IsConst>::operator++() {
     this->node = this->node->nextP;
     return *this;
 }
 
-template <typename T>
-typename List<T>::Iterator List<T>::Iterator::operator++(int) {
-    Iterator new_it = *this;
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+typename List<T, Alloc, Stats>::template BasicIterator<IsConst>
+List<T, Alloc, Stats>::BasicIterator<IsConst>::operator++(int) {
+    BasicIterator new_it = *this;
     if (this->node) {
         this->node = this->node->nextP;
     }
@@ -645,40 +2627,52 @@ typename List<T>::Iterator List<T>::Iterator::operator++(int) {
 }
 
 
-template <typename T>
-typename List<T>::Iterator& List<T>::Iterator::operator--() {
-    this->node = this->node->prevP;
-    return *this;
-}
-
-template <typename T>
-typename List<T>::Iterator List<T>::Iterator::operator--(int) {
-    Iterator new_it = *this;
-    if (this->node->prevP != nullptr) {
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+typename List<T, Alloc, Stats>::template BasicIterator<IsConst>&
+List<T, Alloc, Stats>::BasicIterator<IsConst>::operator--() {
+    if (this->node != nullptr) {
         this->node = this->node->prevP;
     }
-    return new_it;
-}
-
-template <typename T>
-typename List<T>::Iterator& List<T>::Iterator::operator=(const Iterator& right) {
-    if (right.node != this->node) {
-         this->node = right.node;
+    else if (this->owner != nullptr) {
+        this->node = this->owner->tail;
     }
     return *this;
 }
 
-template <typename T>
-bool List<T>::Iterator::operator==(const Iterator& other) const {
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+typename List<T, Alloc, Stats>::template BasicIterator<IsConst>
+List<T, Alloc, Stats>::BasicIterator<IsConst>::operator--(int) {
+    BasicIterator new_it = *this;
+    --(*this);
+    return new_it;
+}
+
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+template <bool OtherConst>
+bool List<T, Alloc, Stats>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
     return this->node == other.node;
 }
 
-template <typename T>
-bool List<T>::Iterator::operator!=(const Iterator& other) const {
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+template <bool OtherConst>
+bool List<T, Alloc, Stats>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
     return this->node != other.node;
 }
 
-template <typename T>
-T List<T>::Iterator::operator*() {
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+typename List<T, Alloc, Stats>::template BasicIterator<IsConst>::reference
+List<T, Alloc, Stats>::BasicIterator<IsConst>::operator*() const {
     return this->node->data;
 }
+
+template <typename T, typename Alloc, typename Stats>
+template <bool IsConst>
+typename List<T, Alloc, Stats>::template BasicIterator<IsConst>::pointer
+List<T, Alloc, Stats>::BasicIterator<IsConst>::operator->() const {
+    return std::addressof(this->node->data);
+}
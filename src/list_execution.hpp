@@ -0,0 +1,37 @@
+#pragma once
+#include <execution>
+
+#include "list.hpp"
+
+/*
+ * Политики std::execution для List::sort(policy, comp). Подключается отдельно:
+ * в libstdc++ <execution> при установленной TBB требует линковки с ней
+ * (например, TBB::tbb), даже если параллельные алгоритмы стандартной библиотеки
+ * не вызываются. Сама сортировка List работает на std::thread.
+ */
+
+template <>
+struct ListExecutionPolicy<std::execution::sequenced_policy> {
+    static constexpr bool enabled = true;
+    static constexpr bool parallel = false;
+};
+
+template <>
+struct ListExecutionPolicy<std::execution::parallel_policy> {
+    static constexpr bool enabled = true;
+    static constexpr bool parallel = true;
+};
+
+template <>
+struct ListExecutionPolicy<std::execution::parallel_unsequenced_policy> {
+    static constexpr bool enabled = true;
+    static constexpr bool parallel = true;
+};
+
+#if defined(__cpp_lib_execution) && __cpp_lib_execution >= 201902L
+template <>
+struct ListExecutionPolicy<std::execution::unsequenced_policy> {
+    static constexpr bool enabled = true;
+    static constexpr bool parallel = false;
+};
+#endif
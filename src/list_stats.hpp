@@ -0,0 +1,222 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/// @brief Счётчики операций списка
+struct ListStats {
+    /// @brief Вызовов ```allocate``` аллокатора узлов
+    uint64_t allocations = 0;
+
+    /// @brief Вызовов ```deallocate``` аллокатора узлов
+    uint64_t deallocations = 0;
+
+    /// @brief Байт, выделенных под узлы и ещё не освобождённых
+    /// @details У отдельного списка может быть отрицательным: узлы, пришедшие через
+    ///     ```splice```, освобождает не тот список, который их выделил
+    int64_t bytesInUse = 0;
+
+    /// @brief Узлов, пройденных ```Iterator::operator+```/```operator-```
+    uint64_t nodesWalked = 0;
+
+    /// @brief Сравнений в ```sort```
+    uint64_t comparisons = 0;
+
+    /// @brief Узлов, у которых ```sort``` сменил предыдущий узел
+    uint64_t relinks = 0;
+
+    /// @brief Вызовов ```splice```
+    uint64_t splices = 0;
+
+    /// @brief Вызовов ```merge```
+    uint64_t merges = 0;
+
+    /// @brief Прибавляет счётчики ```other```
+    /// @param other Прибавляемые счётчики
+    /// @return Ссылка на текущие счётчики
+    ListStats& operator+=(const ListStats& other) {
+        allocations += other.allocations;
+        deallocations += other.deallocations;
+        bytesInUse += other.bytesInUse;
+        nodesWalked += other.nodesWalked;
+        comparisons += other.comparisons;
+        relinks += other.relinks;
+        splices += other.splices;
+        merges += other.merges;
+        return *this;
+    }
+};
+
+/**
+ * @brief Общий счёт всех списков процесса со статистикой
+ * @details Каждый поток пишет в свою запись без атомарных RMW-операций, чтение
+ *      складывает записи живых потоков и итог уже завершившихся
+ */
+class ListStatsRegistry {
+public:
+    /// @brief Запись одного потока
+    struct Shard {
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> deallocations{0};
+        std::atomic<int64_t> bytesInUse{0};
+        std::atomic<uint64_t> nodesWalked{0};
+        std::atomic<uint64_t> comparisons{0};
+        std::atomic<uint64_t> relinks{0};
+        std::atomic<uint64_t> splices{0};
+        std::atomic<uint64_t> merges{0};
+
+        Shard() { instance().attach(this); }
+        ~Shard() { instance().detach(this); }
+
+        /// @brief Прибавляет ```value``` к счётчику; писать в запись может только её поток
+        template <typename U>
+        static void add(std::atomic<U>& counter, U value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        /// @brief Прибавляет значения записи к ```out```
+        void addTo(ListStats& out) const {
+            out.allocations += allocations.load(std::memory_order_relaxed);
+            out.deallocations += deallocations.load(std::memory_order_relaxed);
+            out.bytesInUse += bytesInUse.load(std::memory_order_relaxed);
+            out.nodesWalked += nodesWalked.load(std::memory_order_relaxed);
+            out.comparisons += comparisons.load(std::memory_order_relaxed);
+            out.relinks += relinks.load(std::memory_order_relaxed);
+            out.splices += splices.load(std::memory_order_relaxed);
+            out.merges += merges.load(std::memory_order_relaxed);
+        }
+    };
+
+    /// @brief Реестр процесса
+    static ListStatsRegistry& instance() {
+        static ListStatsRegistry registry;
+        return registry;
+    }
+
+    /// @brief Запись текущего потока
+    static Shard& local() {
+        thread_local Shard shard;
+        return shard;
+    }
+
+    /// @brief Складывает счётчики всех потоков
+    /// @return Общий счёт процесса
+    ListStats total() {
+        std::lock_guard<std::mutex> lock(mutex);
+        ListStats result = retired;
+        for (const Shard* shard : shards) {
+            shard->addTo(result);
+        }
+        return result;
+    }
+
+private:
+    void attach(Shard* shard) {
+        std::lock_guard<std::mutex> lock(mutex);
+        shards.push_back(shard);
+    }
+
+    void detach(Shard* shard) {
+        std::lock_guard<std::mutex> lock(mutex);
+        shard->addTo(retired);
+        shards.erase(std::find(shards.begin(), shards.end(), shard));
+    }
+
+    /// @brief Защищает ```shards``` и ```retired```
+    std::mutex mutex;
+
+    /// @brief Записи живых потоков
+    std::vector<Shard*> shards;
+
+    /// @brief Итог завершившихся потоков
+    ListStats retired;
+};
+
+/// @brief Общий счёт всех списков с ```CountingListStats``` в процессе
+/// @return Сумма счётчиков всех потоков
+inline ListStats globalListStats() {
+    return ListStatsRegistry::instance().total();
+}
+
+/**
+ * @brief Политика статистики по умолчанию: ничего не считает
+ * @details Пустой тип хранится в списке через ```[[no_unique_address]]```, а пустые
+ *      встраиваемые методы не оставляют в коде ни одной инструкции
+ */
+struct NoListStats {
+    static constexpr bool enabled = false;
+
+    void allocated(size_t) {}
+    void deallocated(size_t) {}
+    void walked(size_t) {}
+    void compared(uint64_t) {}
+    void relinked(uint64_t) {}
+    void spliced() {}
+    void merged() {}
+    void absorb(const ListStats&) {}
+
+    ListStats stats() const { return {}; }
+    void reset() {}
+};
+
+/**
+ * @brief Политика статистики со счётчиками списка и общим счётом процесса
+ * @details Счётчики принадлежат объекту списка и не переходят при перемещении или обмене
+ */
+struct CountingListStats {
+    static constexpr bool enabled = true;
+
+    void allocated(size_t bytes) {
+        ++counters.allocations;
+        counters.bytesInUse += static_cast<int64_t>(bytes);
+        auto& shard = ListStatsRegistry::local();
+        ListStatsRegistry::Shard::add<uint64_t>(shard.allocations, 1);
+        ListStatsRegistry::Shard::add<int64_t>(shard.bytesInUse, static_cast<int64_t>(bytes));
+    }
+
+    void deallocated(size_t bytes) {
+        ++counters.deallocations;
+        counters.bytesInUse -= static_cast<int64_t>(bytes);
+        auto& shard = ListStatsRegistry::local();
+        ListStatsRegistry::Shard::add<uint64_t>(shard.deallocations, 1);
+        ListStatsRegistry::Shard::add<int64_t>(shard.bytesInUse, -static_cast<int64_t>(bytes));
+    }
+
+    void walked(size_t nodes) {
+        counters.nodesWalked += nodes;
+        ListStatsRegistry::Shard::add<uint64_t>(ListStatsRegistry::local().nodesWalked, nodes);
+    }
+
+    void compared(uint64_t count) {
+        counters.comparisons += count;
+        ListStatsRegistry::Shard::add<uint64_t>(ListStatsRegistry::local().comparisons, count);
+    }
+
+    void relinked(uint64_t count) {
+        counters.relinks += count;
+        ListStatsRegistry::Shard::add<uint64_t>(ListStatsRegistry::local().relinks, count);
+    }
+
+    void spliced() {
+        ++counters.splices;
+        ListStatsRegistry::Shard::add<uint64_t>(ListStatsRegistry::local().splices, 1);
+    }
+
+    void merged() {
+        ++counters.merges;
+        ListStatsRegistry::Shard::add<uint64_t>(ListStatsRegistry::local().merges, 1);
+    }
+
+    /// @brief Прибавляет к счётчикам списка работу вспомогательного списка
+    /// @details Общий счёт процесса уже учёл её, поэтому не меняется
+    void absorb(const ListStats& other) { counters += other; }
+
+    ListStats stats() const { return counters; }
+    void reset() { counters = ListStats(); }
+
+    /// @brief Счётчики списка
+    ListStats counters;
+};
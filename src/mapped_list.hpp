@@ -0,0 +1,821 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Двусвязный список, узлы которого лежат в отображённом в память файле
+ * @details Файл начинается с заголовка (голова, хвост, размер, ёмкость, список
+ *      свободных узлов), за ним идёт массив узлов. Узлы связаны смещениями от
+ *      начала файла, а не указателями, поэтому файл остаётся корректным при
+ *      отображении по любому адресу. Открытие существующего файла не читает
+ *      узлы: страницы подгружаются при первом обращении. При росте файл
+ *      удлиняется и отображается заново, итераторы (пара список + смещение)
+ *      остаются действительными.
+ *
+ *      Изменения попадают в файл по мере вытеснения страниц, ```flush()```
+ *      дожидается записи. Операции не журналируются: после сбоя посреди
+ *      изменения файл может оказаться несогласованным
+ * @tparam T Тип хранимых элементов; должен быть тривиально копируемым
+ */
+template <typename T>
+class MappedList {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedList stores elements as raw file bytes");
+
+protected:
+    /// @brief Смещение узла от начала файла
+    using Offset = uint64_t;
+
+    /// @brief Отсутствие узла (аналог ```nullptr```); по нулевому смещению лежит заголовок
+    static constexpr Offset npos = 0;
+
+    /**
+     * @brief Узел в файле
+     * @details Свободные узлы связаны через ```nextO```
+     */
+    struct Node {
+        /// @brief Смещение предыдущего узла
+        Offset prevO;
+
+        /// @brief Смещение следующего узла
+        Offset nextO;
+
+        /// @brief Хранящиеся данные
+        T data;
+    };
+
+    /// @brief Заголовок файла
+    struct Header {
+        /// @brief Сигнатура ```fileMagic```
+        uint64_t magic;
+
+        /// @brief ```sizeof(T)``` создавшего файл списка
+        uint32_t elementSize;
+
+        /// @brief ```sizeof(Node)``` создавшего файл списка
+        uint32_t nodeSize;
+
+        /// @brief Смещение первого узла списка
+        Offset head;
+
+        /// @brief Смещение последнего узла списка
+        Offset tail;
+
+        /// @brief Количество элементов
+        uint64_t size;
+
+        /// @brief Количество узлов, под которые выделено место в файле
+        uint64_t capacity;
+
+        /// @brief Количество когда-либо занятых узлов (узлы за ними ещё не использовались)
+        uint64_t used;
+
+        /// @brief Первый свободный узел среди занятых
+        Offset free;
+    };
+
+    /// @brief Сигнатура файла: "DLLMAP01"
+    static constexpr uint64_t fileMagic = 0x313050414D4C4C44;
+
+    /// @brief Смещение первого узла массива
+    static constexpr Offset firstNode = (sizeof(Header) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+
+    /// @brief Заголовок отображённого файла
+    Header* header() const { return reinterpret_cast<Header*>(_base); }
+
+    /// @brief Узел по смещению
+    /// @param offset Смещение узла
+    Node* nodeAt(Offset offset) const { return reinterpret_cast<Node*>(_base + offset); }
+
+    /// @brief Размер файла с ```capacity``` узлами
+    static size_t fileSize(uint64_t capacity) { return firstNode + capacity * sizeof(Node); }
+
+    /**
+     * @brief Удлиняет файл до ```newCapacity``` узлов и отображает его заново
+     * @details Строгая гарантия: при ошибке остаётся старое отображение
+     * @param newCapacity Новая ёмкость (больше текущей)
+     * @exception std::system_error Если системный вызов не удался
+     */
+    void grow(uint64_t newCapacity);
+
+    /**
+     * @brief Занимает свободный узел и конструирует в нём элемент
+     * @param args Аргументы конструктора элемента
+     * @return Смещение узла (ещё не связанного со списком)
+     */
+    template <typename... Args>
+    Offset createNode(Args&&... args);
+
+    /// @brief Возвращает узел в список свободных
+    /// @param offset Смещение узла
+    void destroyNode(Offset offset);
+
+    /// @brief Встраивает узел перед ```next```
+    /// @param next Узел, перед которым встраивается новый; ```npos``` - в конец
+    /// @param offset Встраиваемый узел
+    void linkBefore(Offset next, Offset offset);
+
+    /// @brief Вырезает узел из списка, не освобождая его
+    /// @param offset Смещение узла
+    void unlink(Offset offset);
+
+    /// @brief Снимает отображение и закрывает файл
+    void release();
+
+    /// @brief Файловый дескриптор; ```-1``` у перемещённого списка
+    int _fd = -1;
+
+    /// @brief Начало отображения
+    unsigned char* _base = nullptr;
+
+    /// @brief Длина отображения
+    size_t _length = 0;
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Ёмкость нового файла по умолчанию
+    static constexpr size_t defaultCapacity = 64;
+
+    /**
+     * @brief Открывает список в файле ```path``` или создаёт пустой, если файла нет
+     * @details Время открытия не зависит от размера списка
+     * @param path Путь к файлу
+     * @param capacity Ёмкость создаваемого файла; для существующего не используется
+     * @exception std::system_error Если файл не удалось открыть или отобразить
+     * @exception std::runtime_error Если файл не является списком с таким ```T```
+     */
+    explicit MappedList(const std::string& path, size_t capacity = defaultCapacity);
+
+    /// @brief Деструктор; снимает отображение, не дожидаясь записи на диск
+    ~MappedList();
+
+    MappedList(const MappedList&) = delete;
+    MappedList& operator=(const MappedList&) = delete;
+
+    /// @brief Конструктор перемещения; ```other``` остаётся пригодным только для разрушения и присваивания
+    /// @param other Перемещаемый список
+    MappedList(MappedList&& other) noexcept;
+
+    /// @brief Оператор перемещающего присваивания; текущий файл закрывается
+    /// @param other Перемещаемый список
+    /// @return Ссылка на текущий список
+    MappedList& operator=(MappedList&& other) noexcept;
+
+    /**
+     * @brief Двунаправленный итератор по смещениям узлов
+     * @details Хранит список и смещение, поэтому не теряет действительность при росте файла
+     * @tparam IsConst ```true``` для итератора на константные элементы
+     */
+    template <bool IsConst>
+    struct BasicIterator {
+        friend class MappedList;
+        template <bool> friend struct BasicIterator;
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+        using Owner = std::conditional_t<IsConst, const MappedList, MappedList>;
+
+        /// @brief Создаёт итератор, не связанный ни с одним списком
+        BasicIterator() = default;
+
+        /// @brief Конструирование на основе смещения
+        /// @param owner Список
+        /// @param offset Смещение узла; ```npos``` - ```end()```
+        BasicIterator(Owner* owner, Offset offset) : owner(owner), offset(offset) {}
+
+        /// @brief Преобразование итератора в константный
+        /// @param other Неконстантный итератор
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other) : owner(other.owner), offset(other.offset) {}
+
+        /// @brief Пре-инкрементный сдвиг на следующий элемент
+        /// @return Итератор на следующий элемент
+        BasicIterator& operator++() {
+            offset = owner->nodeAt(offset)->nextO;
+            return *this;
+        }
+
+        /// @brief Пост-инкрементный сдвиг на следующий элемент
+        /// @return Итератор до сдвига
+        BasicIterator operator++(int) {
+            BasicIterator old = *this;
+            ++(*this);
+            return old;
+        }
+
+        /// @brief Пре-декрементный сдвиг на предыдущий элемент; от ```end()``` - к последнему
+        /// @return Итератор на предыдущий элемент
+        BasicIterator& operator--() {
+            offset = offset != npos ? owner->nodeAt(offset)->prevO : owner->header()->tail;
+            return *this;
+        }
+
+        /// @brief Пост-декрементный сдвиг на предыдущий элемент
+        /// @return Итератор до сдвига
+        BasicIterator operator--(int) {
+            BasicIterator old = *this;
+            --(*this);
+            return old;
+        }
+
+        /// @brief Сравнение двух итераторов
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator==(const BasicIterator<OtherConst>& other) const { return offset == other.offset; }
+
+        /// @brief Проверка на неравенство двух итераторов
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator!=(const BasicIterator<OtherConst>& other) const { return offset != other.offset; }
+
+        /// @brief Доступ к элементу
+        /// @return Ссылка на элемент
+        reference operator*() const { return owner->nodeAt(offset)->data; }
+
+        /// @brief Доступ к членам элемента
+        /// @return Указатель на элемент
+        pointer operator->() const { return std::addressof(owner->nodeAt(offset)->data); }
+
+    protected:
+        /// @brief Список, по которому идёт обход
+        Owner* owner = nullptr;
+
+        /// @brief Смещение текущего узла
+        Offset offset = npos;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    /// @brief Поэлементное сравнение двух списков
+    /// @param other Сравниваемый список
+    /// @return Результат сравнения
+    bool operator==(const MappedList& other) const;
+
+    /// @brief Поэлементная проверка на неравенство двух списков
+    /// @param other Сравниваемый список
+    /// @return Результат сравнения
+    bool operator!=(const MappedList& other) const;
+
+    /// @brief Доступ к первому элементу списка
+    /// @return Первый элемент
+    T& front();
+
+    /// @copydoc front()
+    const T& front() const;
+
+    /// @brief Доступ к последнему элементу списка
+    /// @return Последний элемент
+    T& back();
+
+    /// @copydoc back()
+    const T& back() const;
+
+    /// @brief Добавление в начало списка
+    /// @param data Добавляемые данные
+    void push_front(const T& data);
+
+    /// @brief Добавление в конец списка
+    /// @param data Добавляемые данные
+    void push_back(const T& data);
+
+    /// @brief Конструирует элемент в начале списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_front(Args&&... args);
+
+    /// @brief Конструирует элемент в конце списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+
+    /// @brief Удаление из начала списка
+    void pop_front();
+
+    /// @brief Удаление из конца списка
+    void pop_back();
+
+    /// @brief Вставка элемента в позицию
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param value Вставляемое значение
+    /// @return Итератор на вставленный элемент
+    Iterator insert(ConstIterator pos, const T& value);
+
+    /// @brief Конструирует элемент перед ```pos```
+    /// @param pos Итератор, указывающий на позицию для вставки
+    /// @param args Аргументы конструктора элемента
+    /// @return Итератор на созданный элемент
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args);
+
+    /// @brief Удаление элемента в позиции; узел переиспользуется следующей вставкой
+    /// @param pos Позиция удаляемого элемента
+    /// @return Итератор на следующий элемент
+    Iterator erase(ConstIterator pos);
+
+    /// @brief Удаление элементов в диапазоне [```first```, ```last```)
+    /// @param first Первый удаляемый элемент
+    /// @param last Элемент, до которого идёт удаление
+    /// @return Итератор на элемент ```last```
+    Iterator erase(ConstIterator first, ConstIterator last);
+
+    /// @brief Сортирует элементы списка
+    void sort();
+
+    /// @brief Устойчиво сортирует элементы списка с помощью компаратора
+    /// @details Элементы не перемещаются: сортируется вспомогательный массив
+    ///     смещений, после чего узлы перевязываются
+    /// @param comp Компаратор: ```true```, если первый элемент строго меньше второго
+    template <typename Compare>
+    void sort(Compare comp);
+
+    /// @brief Оборачивание списка (элементы в обратном порядке)
+    void reverse();
+
+    /// @brief Удаляет все элементы; размер файла сохраняется
+    void clear();
+
+    /// @brief Удлиняет файл под ```count``` элементов
+    /// @param count Требуемая ёмкость
+    void reserve(size_t count);
+
+    /// @brief Ёмкость файла
+    /// @return Количество элементов, которые поместятся без удлинения файла
+    size_t capacity() const;
+
+    /**
+     * @brief Дожидается записи изменённых страниц на диск
+     * @exception std::system_error Если запись не удалась
+     */
+    void flush();
+
+    /// @brief Проверка на наличие элементов в списке
+    /// @return ```true```, если список пустой
+    bool empty() const;
+
+    /// @brief Возвращает размер списка
+    /// @return Количество элементов списка
+    size_t size() const;
+
+    Iterator begin();
+    ConstIterator begin() const;
+    Iterator end();
+    ConstIterator end() const;
+    ConstIterator cbegin() const;
+    ConstIterator cend() const;
+    reverse_iterator rbegin();
+    const_reverse_iterator rbegin() const;
+    reverse_iterator rend();
+    const_reverse_iterator rend() const;
+};
+
+template <typename T>
+MappedList<T>::MappedList(const std::string& path, size_t capacity) {
+    _fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (_fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "open " + path);
+    }
+    try {
+        struct stat info;
+        if (::fstat(_fd, &info) != 0) {
+            throw std::system_error(errno, std::generic_category(), "fstat " + path);
+        }
+        bool created = info.st_size == 0;
+        if (created) {
+            capacity = std::max<size_t>(1, capacity);
+            if (::ftruncate(_fd, static_cast<off_t>(fileSize(capacity))) != 0) {
+                throw std::system_error(errno, std::generic_category(), "ftruncate " + path);
+            }
+            _length = fileSize(capacity);
+        }
+        else if (static_cast<size_t>(info.st_size) < sizeof(Header)) {
+            throw std::runtime_error("Invalid list file");
+        }
+        else {
+            _length = static_cast<size_t>(info.st_size);
+        }
+        void* base = ::mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+        if (base == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "mmap " + path);
+        }
+        _base = static_cast<unsigned char*>(base);
+
+        Header* h = header();
+        if (created) {
+            *h = Header{fileMagic, sizeof(T), sizeof(Node), npos, npos, 0, capacity, 0, npos};
+        }
+        else if (h->magic != fileMagic || h->elementSize != sizeof(T) || h->nodeSize != sizeof(Node)
+                 || h->used > h->capacity || h->size > h->used || fileSize(h->capacity) > _length) {
+            throw std::runtime_error("Invalid list file");
+        }
+    }
+    catch (...) {
+        release();
+        throw;
+    }
+}
+
+template <typename T>
+MappedList<T>::~MappedList() {
+    release();
+}
+
+template <typename T>
+MappedList<T>::MappedList(MappedList&& other) noexcept
+    : _fd(std::exchange(other._fd, -1)),
+      _base(std::exchange(other._base, nullptr)),
+      _length(std::exchange(other._length, 0)) {}
+
+template <typename T>
+MappedList<T>& MappedList<T>::operator=(MappedList&& other) noexcept {
+    if (this != &other) {
+        release();
+        _fd = std::exchange(other._fd, -1);
+        _base = std::exchange(other._base, nullptr);
+        _length = std::exchange(other._length, 0);
+    }
+    return *this;
+}
+
+template <typename T>
+void MappedList<T>::release() {
+    if (_base != nullptr) {
+        ::munmap(_base, _length);
+        _base = nullptr;
+        _length = 0;
+    }
+    if (_fd >= 0) {
+        ::close(_fd);
+        _fd = -1;
+    }
+}
+
+template <typename T>
+void MappedList<T>::grow(uint64_t newCapacity) {
+    size_t length = fileSize(newCapacity);
+    if (::ftruncate(_fd, static_cast<off_t>(length)) != 0) {
+        throw std::system_error(errno, std::generic_category(), "ftruncate");
+    }
+#ifdef __linux__
+    // mremap сохраняет уже подгруженные страницы и не копирует таблицы заново
+    void* base = ::mremap(_base, _length, length, MREMAP_MAYMOVE);
+    if (base == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "mremap");
+    }
+#else
+    void* base = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (base == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "mmap");
+    }
+    ::munmap(_base, _length);
+#endif
+    _base = static_cast<unsigned char*>(base);
+    _length = length;
+    header()->capacity = newCapacity;
+}
+
+template <typename T>
+template <typename... Args>
+typename MappedList<T>::Offset MappedList<T>::createNode(Args&&... args) {
+    Header* h = header();
+    Offset offset = h->free;
+    if (offset != npos) {
+        ::new (static_cast<void*>(std::addressof(nodeAt(offset)->data))) T(std::forward<Args>(args)...);
+        h->free = nodeAt(offset)->nextO;
+        return offset;
+    }
+    if (h->used == h->capacity) {
+        // аргументы могут ссылаться на элементы этого же списка, а рост меняет адрес
+        // отображения, поэтому значение создаётся заранее
+        T value(std::forward<Args>(args)...);
+        grow(std::max<uint64_t>(defaultCapacity, h->capacity * 2));
+        h = header();
+        offset = firstNode + h->used * sizeof(Node);
+        ::new (static_cast<void*>(std::addressof(nodeAt(offset)->data))) T(std::move(value));
+    }
+    else {
+        offset = firstNode + h->used * sizeof(Node);
+        ::new (static_cast<void*>(std::addressof(nodeAt(offset)->data))) T(std::forward<Args>(args)...);
+    }
+    ++h->used;
+    return offset;
+}
+
+template <typename T>
+void MappedList<T>::destroyNode(Offset offset) {
+    Node* node = nodeAt(offset);
+    node->prevO = npos;
+    node->nextO = header()->free;
+    header()->free = offset;
+}
+
+template <typename T>
+void MappedList<T>::linkBefore(Offset next, Offset offset) {
+    Header* h = header();
+    Offset prev = next != npos ? nodeAt(next)->prevO : h->tail;
+    nodeAt(offset)->prevO = prev;
+    nodeAt(offset)->nextO = next;
+
+    if (prev != npos) {
+        nodeAt(prev)->nextO = offset;
+    }
+    else {
+        h->head = offset;
+    }
+    if (next != npos) {
+        nodeAt(next)->prevO = offset;
+    }
+    else {
+        h->tail = offset;
+    }
+    ++h->size;
+}
+
+template <typename T>
+void MappedList<T>::unlink(Offset offset) {
+    Header* h = header();
+    Node* node = nodeAt(offset);
+    if (node->prevO != npos) {
+        nodeAt(node->prevO)->nextO = node->nextO;
+    }
+    else {
+        h->head = node->nextO;
+    }
+    if (node->nextO != npos) {
+        nodeAt(node->nextO)->prevO = node->prevO;
+    }
+    else {
+        h->tail = node->prevO;
+    }
+    --h->size;
+}
+
+template <typename T>
+bool MappedList<T>::operator==(const MappedList& other) const {
+    return size() == other.size() && std::equal(begin(), end(), other.begin());
+}
+
+template <typename T>
+bool MappedList<T>::operator!=(const MappedList& other) const {
+    return !(*this == other);
+}
+
+template <typename T>
+T& MappedList<T>::front() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return nodeAt(header()->head)->data;
+}
+
+template <typename T>
+const T& MappedList<T>::front() const {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return nodeAt(header()->head)->data;
+}
+
+template <typename T>
+T& MappedList<T>::back() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return nodeAt(header()->tail)->data;
+}
+
+template <typename T>
+const T& MappedList<T>::back() const {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    return nodeAt(header()->tail)->data;
+}
+
+template <typename T>
+void MappedList<T>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template <typename T>
+void MappedList<T>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template <typename T>
+template <typename... Args>
+T& MappedList<T>::emplace_front(Args&&... args) {
+    return *emplace(cbegin(), std::forward<Args>(args)...);
+}
+
+template <typename T>
+template <typename... Args>
+T& MappedList<T>::emplace_back(Args&&... args) {
+    return *emplace(cend(), std::forward<Args>(args)...);
+}
+
+template <typename T>
+void MappedList<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(begin());
+}
+
+template <typename T>
+void MappedList<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(--end());
+}
+
+template <typename T>
+typename MappedList<T>::Iterator MappedList<T>::insert(ConstIterator pos, const T& value) {
+    return emplace(pos, value);
+}
+
+template <typename T>
+template <typename... Args>
+typename MappedList<T>::Iterator MappedList<T>::emplace(ConstIterator pos, Args&&... args) {
+    // смещение позиции переживает повторное отображение файла внутри createNode
+    Offset offset = createNode(std::forward<Args>(args)...);
+    linkBefore(pos.offset, offset);
+    return Iterator(this, offset);
+}
+
+template <typename T>
+typename MappedList<T>::Iterator MappedList<T>::erase(ConstIterator pos) {
+    if (empty()) {
+        throw std::out_of_range("Trying to erase in empty list!");
+    }
+    if (pos.offset == npos) {
+        throw std::out_of_range("Invalid erasing");
+    }
+    Offset next = nodeAt(pos.offset)->nextO;
+    unlink(pos.offset);
+    destroyNode(pos.offset);
+    return Iterator(this, next);
+}
+
+template <typename T>
+typename MappedList<T>::Iterator MappedList<T>::erase(ConstIterator first, ConstIterator last) {
+    while (first != last) {
+        first = erase(first);
+    }
+    return Iterator(this, last.offset);
+}
+
+template <typename T>
+void MappedList<T>::sort() {
+    sort(std::less<T>());
+}
+
+template <typename T>
+template <typename Compare>
+void MappedList<T>::sort(Compare comp) {
+    if (size() < 2) {
+        return;
+    }
+    std::vector<Offset> order;
+    order.reserve(size());
+    for (Offset o = header()->head; o != npos; o = nodeAt(o)->nextO) {
+        order.push_back(o);
+    }
+    std::stable_sort(order.begin(), order.end(), [this, &comp](Offset left, Offset right) {
+        return comp(nodeAt(left)->data, nodeAt(right)->data);
+    });
+    Offset prev = npos;
+    for (Offset o : order) {
+        nodeAt(o)->prevO = prev;
+        if (prev != npos) {
+            nodeAt(prev)->nextO = o;
+        }
+        prev = o;
+    }
+    nodeAt(prev)->nextO = npos;
+    header()->head = order.front();
+    header()->tail = order.back();
+}
+
+template <typename T>
+void MappedList<T>::reverse() {
+    for (Offset o = header()->head; o != npos; o = nodeAt(o)->prevO) {
+        std::swap(nodeAt(o)->prevO, nodeAt(o)->nextO);
+    }
+    std::swap(header()->head, header()->tail);
+}
+
+template <typename T>
+void MappedList<T>::clear() {
+    Header* h = header();
+    h->head = h->tail = h->free = npos;
+    h->size = h->used = 0;
+}
+
+template <typename T>
+void MappedList<T>::reserve(size_t count) {
+    if (count > capacity()) {
+        grow(count);
+    }
+}
+
+template <typename T>
+size_t MappedList<T>::capacity() const {
+    return header()->capacity;
+}
+
+template <typename T>
+void MappedList<T>::flush() {
+    if (::msync(_base, _length, MS_SYNC) != 0) {
+        throw std::system_error(errno, std::generic_category(), "msync");
+    }
+}
+
+template <typename T>
+bool MappedList<T>::empty() const {
+    return header()->size == 0;
+}
+
+template <typename T>
+size_t MappedList<T>::size() const {
+    return header()->size;
+}
+
+template <typename T>
+typename MappedList<T>::Iterator MappedList<T>::begin() {
+    return Iterator(this, header()->head);
+}
+
+template <typename T>
+typename MappedList<T>::ConstIterator MappedList<T>::begin() const {
+    return ConstIterator(this, header()->head);
+}
+
+template <typename T>
+typename MappedList<T>::Iterator MappedList<T>::end() {
+    return Iterator(this, npos);
+}
+
+template <typename T>
+typename MappedList<T>::ConstIterator MappedList<T>::end() const {
+    return ConstIterator(this, npos);
+}
+
+template <typename T>
+typename MappedList<T>::ConstIterator MappedList<T>::cbegin() const {
+    return begin();
+}
+
+template <typename T>
+typename MappedList<T>::ConstIterator MappedList<T>::cend() const {
+    return end();
+}
+
+template <typename T>
+typename MappedList<T>::reverse_iterator MappedList<T>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template <typename T>
+typename MappedList<T>::const_reverse_iterator MappedList<T>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+template <typename T>
+typename MappedList<T>::reverse_iterator MappedList<T>::rend() {
+    return reverse_iterator(begin());
+}
+
+template <typename T>
+typename MappedList<T>::const_reverse_iterator MappedList<T>::rend() const {
+    return const_reverse_iterator(begin());
+}
@@ -1,42 +1,203 @@
 #pragma once
-#include <iostream>
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
 
-template <typename T>
-class List;
+/**
+ * @brief Слияние двух отсортированных цепочек узлов
+ * @details Цепочки связаны только через ```nextP```; ```prevP``` не трогается.
+ *      При равенстве первым идёт узел из ```left```, поэтому слияние устойчиво.
+ *      Если ```comp``` бросает исключение, в ```left``` остаются все узлы обеих цепочек
+ * @param left Первая (более ранняя) цепочка; сюда же записывается результат
+ * @param right Вторая цепочка
+ * @param comp Сравнение узлов: ```true```, если первый узел строго меньше второго
+ */
+template <typename Node, typename Compare>
+void mergeNodes(Node*& left, Node* right, Compare& comp) {
+    Node* head = nullptr;
+    Node** link = &head;
+    Node* curr = left;
 
-template <typename T>
-List<T> mergeSort(const List<T>& coll) {
-    if (coll.size() == 1) {
-        return coll;
+    try {
+        while (curr != nullptr && right != nullptr) {
+            if (comp(right, curr)) {
+                *link = right;
+                right = right->nextP;
+            }
+            else {
+                *link = curr;
+                curr = curr->nextP;
+            }
+            link = &(*link)->nextP;
+        }
     }
-    List<T> left(coll.begin(), coll.begin() + coll.size() / 2);
-    List<T> right(coll.begin() + coll.size() / 2 , coll.end());
-
-    left = mergeSort(left);
-    right = mergeSort(right);
-    return merge(left, right);;
+    catch (...) {
+        *link = curr;
+        while (*link != nullptr) {
+            link = &(*link)->nextP;
+        }
+        *link = right;
+        left = head;
+        throw;
+    }
+    *link = (curr != nullptr) ? curr : right;
+    left = head;
 }
 
-template <typename T>
-List<T> merge(List<T>& leftColl, List<T>& rightColl) {
-    List<T> res;
+/**
+ * @brief Устойчивая сортировка слиянием цепочки узлов без выделения памяти
+ * @details Восходящая сортировка: отсортированные серии длины 2^i хранятся в
+ *      массиве ```bins```, новые узлы сливаются с ними как при двоичном сложении.
+ *      Элементы не копируются и не перемещаются, меняются только ```nextP```.
+ *      При исключении из ```comp``` в ```first``` остаются все узлы в неопределённом порядке
+ * @param first Первый узел цепочки (завершается ```nullptr```); сюда же записывается результат
+ * @param comp Сравнение узлов: ```true```, если первый узел строго меньше второго
+ */
+template <typename Node, typename Compare>
+void sortNodes(Node*& first, Compare comp) {
+    Node* bins[64] = {};
+    size_t fill = 0;
+    Node* chain = first;
 
-    while (!leftColl.empty() && !rightColl.empty() ) {
-        if (leftColl.front() < rightColl.front()) {
-            res.push_back(leftColl.front());
-            leftColl.pop_front();
+    try {
+        while (chain != nullptr) {
+            Node* carry = chain;
+            chain = chain->nextP;
+            carry->nextP = nullptr;
+
+            size_t i = 0;
+            for (; i < fill && bins[i] != nullptr; ++i) {
+                mergeNodes(bins[i], carry, comp);
+                carry = bins[i];
+                bins[i] = nullptr;
+            }
+            bins[i] = carry;
+            if (i == fill) {
+                ++fill;
+            }
         }
-        else {
-            res.push_back(rightColl.front());
-            rightColl.pop_front();
+
+        Node* result = nullptr;
+        for (size_t i = 0; i < fill; ++i) {
+            if (bins[i] != nullptr) {
+                mergeNodes(bins[i], result, comp);
+                result = bins[i];
+                bins[i] = nullptr;
+            }
         }        
+        first = result;
+    }
+    catch (...) {
+        Node** link = &first;
+        for (size_t i = 0; i < fill; ++i) {
+            *link = bins[i];
+            while (*link != nullptr) {
+                link = &(*link)->nextP;
+            }
+        }
+        *link = chain;
+        throw;
     }
+}
+
+/**
+ * @brief Выполняет задачи ```task(0)```...```task(count - 1)``` в отдельных потоках
+ * @details Задача 0 выполняется в вызывающем потоке. Если поток создать не удалось,
+ *      задача выполняется в вызывающем потоке. Исключения задач собираются и после
+ *      завершения всех потоков пробрасывается первое из них
+ * @param count Количество задач
+ * @param task Задача; принимает номер задачи
+ */
+template <typename Task>
+void runTasks(size_t count, Task& task) {
+    std::vector<std::exception_ptr> errors(count);
+    std::vector<std::thread> threads;
+    threads.reserve(count);
 
-    if (leftColl.empty()) {
-        res.merge(rightColl);
-    }    
-    else if (rightColl.empty()) {
-        res.merge(leftColl);
+    auto guarded = [&task, &errors](size_t i) {
+        try {
+            task(i);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    for (size_t i = 1; i < count; ++i) {
+        try {
+            threads.emplace_back(guarded, i);
+        }
+        catch (...) {
+            guarded(i);
+        }
+    }
+    guarded(0);
+    for (std::thread& thread : threads) {
+        thread.join();
     }
-    return res;
-}
\ No newline at end of file
+    for (std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * @brief Параллельная устойчивая сортировка цепочки узлов
+ * @details Цепочка режется на ```chunks``` частей, которые сортируются ```sortNodes```
+ *      в отдельных потоках; затем соседние серии попарно сливаются, тоже параллельно.
+ *      Узлы не выделяются и не копируются, каждая задача работает с копией ```comp```.
+ *      При исключении в ```first``` остаются все узлы в неопределённом порядке
+ * @param first Первый узел цепочки (завершается ```nullptr```); сюда же записывается результат
+ * @param count Количество узлов в цепочке
+ * @param comp Сравнение узлов: ```true```, если первый узел строго меньше второго
+ * @param chunks Количество частей (потоков)
+ */
+template <typename Node, typename Compare>
+void sortNodesParallel(Node*& first, size_t count, Compare comp, size_t chunks) {
+    chunks = std::min(chunks, count);
+    std::vector<Node*> runs(chunks, nullptr);
+
+    Node* chain = first;
+    for (size_t i = 0; i < chunks; ++i) {
+        size_t length = count / chunks + (i < count % chunks ? 1 : 0);
+        runs[i] = chain;
+        for (size_t j = 1; j < length; ++j) {
+            chain = chain->nextP;
+        }
+        Node* next = chain->nextP;
+        chain->nextP = nullptr;
+        chain = next;
+    }
+
+    try {
+        auto sortTask = [&runs, &comp](size_t i) {
+            sortNodes(runs[i], comp);
+        };
+        runTasks(chunks, sortTask);
+
+        for (size_t width = 1; width < chunks; width *= 2) {
+            auto mergeTask = [&runs, &comp, width](size_t k) {
+                Compare localComp = comp;
+                size_t left = 2 * k * width;
+                Node* right = runs[left + width];
+                runs[left + width] = nullptr;
+                mergeNodes(runs[left], right, localComp);
+            };
+            size_t pairs = (chunks - width + 2 * width - 1) / (2 * width);
+            runTasks(pairs, mergeTask);
+        }
+    }
+    catch (...) {
+        Node** link = &first;
+        for (Node* run : runs) {
+            *link = run;
+            while (*link != nullptr) {
+                link = &(*link)->nextP;
+            }
+        }
+        throw;
+    }
+    first = runs[0];
+}
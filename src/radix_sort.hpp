@@ -0,0 +1,106 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Можно ли сортировать значения ```K``` поразрядно
+ * @details Целые типы и ```float```/```double``` в формате IEEE 754
+ */
+template <typename K>
+inline constexpr bool isRadixKey = std::is_integral_v<K>
+    || (std::is_floating_point_v<K> && std::numeric_limits<K>::is_iec559 && (sizeof(K) == 4 || sizeof(K) == 8));
+
+/**
+ * @brief Беззнаковый ключ, порядок которого совпадает с порядком ```value```
+ * @details У знаковых целых инвертируется знаковый бит; у чисел с плавающей точкой
+ *      отрицательные инвертируются целиком, а у остальных выставляется знаковый бит.
+ *      ```-0.0``` и ```+0.0``` дают один ключ, как и при сравнении ```<```
+ * @param value Значение
+ * @return Ключ
+ */
+template <typename K>
+auto radixKey(K value) {
+    static_assert(isRadixKey<K>, "radixKey requires an integral or IEEE 754 floating point type");
+    if constexpr (std::is_same_v<K, bool>) {
+        return static_cast<uint8_t>(value);
+    }
+    else if constexpr (std::is_integral_v<K>) {
+        using U = std::make_unsigned_t<K>;
+        U bits = static_cast<U>(value);
+        if constexpr (std::is_signed_v<K>) {
+            bits ^= U(1) << (sizeof(U) * 8 - 1);
+        }
+        return bits;
+    }
+    else {
+        using U = std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>;
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        U bits = std::bit_cast<U>(value == K(0) ? K(0) : value);
+        return (bits & sign) != 0 ? U(~bits) : U(bits | sign);
+    }
+}
+
+/**
+ * @brief Устойчивая поразрядная сортировка (LSD) цепочки узлов по беззнаковому ключу
+ * @details Цепочка обходится один раз: указатели на узлы собираются в ```order```, а
+ *      заодно считаются гистограммы всех разрядов. Затем указатели раскладываются по
+ *      256 корзинам на каждый байт ключа; байты, одинаковые у всех узлов, пропускаются.
+ *      Узлы и элементы не трогаются - меняется только порядок указателей, связи
+ *      перевязывает вызывающий, поэтому при исключении из ```key``` или нехватке
+ *      памяти цепочка остаётся прежней
+ * @param first Первый узел цепочки, связанной через ```nextP``` и завершённой ```nullptr```
+ * @param order Сюда записываются узлы в отсортированном порядке; должен быть пуст
+ * @param key Функция узла, возвращающая беззнаковый ключ
+ */
+template <typename Node, typename Key>
+void radixSortNodes(Node* first, std::vector<Node*>& order, Key key) {
+    using KeyType = std::decay_t<decltype(key(first))>;
+    static_assert(std::is_unsigned_v<KeyType>, "radixSortNodes requires an unsigned key");
+    constexpr size_t digits = sizeof(KeyType);
+    constexpr size_t buckets = 256;
+
+    size_t counts[digits][buckets] = {};
+    for (Node* node = first; node != nullptr; node = node->nextP) {
+        KeyType value = key(node);
+        for (size_t d = 0; d < digits; ++d) {
+            ++counts[d][(value >> (d * 8)) & 0xFF];
+        }
+        order.push_back(node);
+    }
+    size_t count = order.size();
+    if (count < 2) {
+        return;
+    }
+
+    std::vector<Node*> scratch(count);
+    // упреждающая подгрузка узлов, ключи которых будут прочитаны через несколько шагов
+    constexpr size_t prefetchDistance = 16;
+    for (size_t d = 0; d < digits; ++d) {
+        const size_t* histogram = counts[d];
+        size_t firstDigit = (key(order[0]) >> (d * 8)) & 0xFF;
+        if (histogram[firstDigit] == count) {
+            continue;
+        }
+        size_t offsets[buckets];
+        size_t sum = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            offsets[b] = sum;
+            sum += histogram[b];
+        }
+        for (size_t i = 0; i < count; ++i) {
+#if defined(__GNUC__) || defined(__clang__)
+            if (i + prefetchDistance < count) {
+                __builtin_prefetch(order[i + prefetchDistance]);
+            }
+#endif
+            Node* node = order[i];
+            scratch[offsets[(key(node) >> (d * 8)) & 0xFF]++] = node;
+        }
+        order.swap(scratch);
+    }
+}
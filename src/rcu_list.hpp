@@ -0,0 +1,629 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Эпохи процесса для отложенного освобождения узлов ```RcuList```
+ * @details Каждый поток-читатель объявляет в своей записи эпоху, в которой начал
+ *      чтение. Писатель помечает вырезанный узел текущей эпохой и сдвигает её;
+ *      узел можно освободить, когда все активные читатели объявили более позднюю
+ *      эпоху. Записи потоков лежат в отдельных кэш-линиях, поэтому читатели не
+ *      пишут в общую память
+ */
+class EpochDomain {
+public:
+    /// @brief Запись одного потока
+    struct alignas(64) Participant {
+        /// @brief Эпоха начала чтения; 0 - поток не читает
+        std::atomic<uint64_t> epoch{0};
+
+        /// @brief Глубина вложенных секций чтения; меняет только свой поток
+        unsigned depth = 0;
+
+        Participant() { instance().attach(this); }
+        ~Participant() { instance().detach(this); }
+    };
+
+    /// @brief Эпохи процесса
+    static EpochDomain& instance() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    /// @brief Запись текущего потока
+    static Participant& local() {
+        thread_local Participant participant;
+        return participant;
+    }
+
+    /// @brief Начинает секцию чтения; секции могут быть вложенными
+    void enter() {
+        Participant& self = local();
+        if (self.depth++ == 0) {
+            self.epoch.store(globalEpoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+            // объявление эпохи должно стать видно писателю раньше, чем поток прочтёт первый узел
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+
+    /// @brief Завершает секцию чтения
+    void leave() {
+        Participant& self = local();
+        if (--self.depth == 0) {
+            self.epoch.store(0, std::memory_order_release);
+        }
+    }
+
+    /// @brief Сдвигает эпоху; вызывается после вырезания узлов
+    /// @return Эпоха, которой помечаются вырезанные узлы
+    uint64_t advance() {
+        return globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    /// @brief Самая ранняя эпоха активных читателей
+    /// @return Эпоха или максимум ```uint64_t```, если никто не читает
+    uint64_t oldestActive() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::lock_guard<std::mutex> lock(mutex);
+        uint64_t oldest = std::numeric_limits<uint64_t>::max();
+        for (const Participant* participant : participants) {
+            uint64_t epoch = participant->epoch.load(std::memory_order_acquire);
+            if (epoch != 0) {
+                oldest = std::min(oldest, epoch);
+            }
+        }
+        return oldest;
+    }
+
+private:
+    void attach(Participant* participant) {
+        std::lock_guard<std::mutex> lock(mutex);
+        participants.push_back(participant);
+    }
+
+    void detach(Participant* participant) {
+        std::lock_guard<std::mutex> lock(mutex);
+        participants.erase(std::find(participants.begin(), participants.end(), participant));
+    }
+
+    /// @brief Текущая эпоха; читается на входе в каждую секцию чтения
+    alignas(64) std::atomic<uint64_t> globalEpoch{1};
+
+    /// @brief Защищает ```participants```
+    alignas(64) std::mutex mutex;
+
+    /// @brief Записи живых потоков
+    std::vector<Participant*> participants;
+};
+
+/**
+ * @brief Двусвязный список для частого чтения и редких изменений (в духе RCU)
+ * @details Читатели обходят цепочку ```nextP``` без блокировок и атомарных RMW-операций:
+ *      вход в секцию чтения - запись эпохи в свою запись ```EpochDomain``` и барьер.
+ *      Писатели упорядочены мьютексом и публикуют вставку и удаление release-записью
+ *      ```nextP``` предыдущего узла. Вырезанный узел сохраняет свой ```nextP```, поэтому
+ *      читатель, стоящий на нём, продолжает обход, а освобождается узел только после
+ *      того, как все начавшиеся раньше секции чтения завершились. Элементы после
+ *      вставки не меняются: читатели получают только константный доступ
+ * @tparam T Тип хранимых элементов
+ * @tparam Alloc Аллокатор элементов; должен быть потокобезопасным
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class RcuList {
+protected:
+    /// @brief Узел списка
+    struct Node {
+        /// @brief Указатель на следующий узел; единственная связь, которую видят читатели
+        std::atomic<Node*> nextP{nullptr};
+
+        /// @brief Указатель на предыдущий узел; только для писателей
+        Node* prevP = nullptr;
+
+        union {
+            /// @brief Хранящиеся данные
+            T data;
+        };
+
+        Node() {}
+        ~Node() {}
+    };
+
+    /// @brief Вырезанный узел, ожидающий освобождения
+    struct Retired {
+        Node* node;
+
+        /// @brief Эпоха, в которой узел вырезан
+        uint64_t epoch;
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
+    using ValueAllocTraits = std::allocator_traits<Alloc>;
+
+    /// @brief После скольких ожидающих узлов писатель пытается их освободить
+    static constexpr size_t reclaimThreshold = 64;
+
+    /**
+     * @brief Выделяет узел и конструирует в нём элемент
+     * @param args Аргументы конструктора элемента
+     * @return Указатель на новый узел
+     */
+    template <typename... Args>
+    Node* createNode(Args&&... args);
+
+    /// @brief Разрушает элемент узла и освобождает узел
+    /// @param node Указатель на узел
+    void destroyNode(Node* node);
+
+    /// @brief Встраивает узел в начало или конец; вызывается под ```_writeMutex```
+    /// @param front ```true``` для вставки в начало
+    /// @param node Встраиваемый узел
+    void linkEnd(bool front, Node* node);
+
+    /// @brief Вырезает узел из цепочки, не трогая его ```nextP```; вызывается под ```_writeMutex```
+    /// @param node Вырезаемый узел
+    void unlink(Node* node);
+
+    /// @brief Откладывает освобождение узлов ```_retired[from..]```, вырезанных в текущей эпохе
+    /// @param from Номер первого нового узла в ```_retired```
+    void retire(size_t from);
+
+    /// @brief Освобождает узлы, которые не может видеть ни один читатель; вызывается под ```_writeMutex```
+    void reclaim();
+
+    /// @brief Аллокатор узлов
+    NodeAlloc _alloc;
+
+    /// @brief Первый узел; публикуется release-записью
+    alignas(64) std::atomic<Node*> _first{nullptr};
+
+    /// @brief Количество элементов
+    std::atomic<size_t> _count{0};
+
+    /// @brief Упорядочивает писателей
+    alignas(64) std::mutex _writeMutex;
+
+    /// @brief Последний узел; только для писателей
+    Node* _last = nullptr;
+
+    /// @brief Вырезанные узлы в порядке эпох
+    std::vector<Retired> _retired;
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+
+    /// @brief Однонаправленный константный итератор секции чтения
+    class ConstIterator {
+        friend class RcuList;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        ConstIterator() = default;
+
+        const T& operator*() const { return node->data; }
+        const T* operator->() const { return &node->data; }
+
+        ConstIterator& operator++() {
+            node = node->nextP.load(std::memory_order_acquire);
+            return *this;
+        }
+
+        ConstIterator operator++(int) {
+            ConstIterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const ConstIterator& other) const { return node == other.node; }
+        bool operator!=(const ConstIterator& other) const { return node != other.node; }
+
+    private:
+        explicit ConstIterator(const Node* node) : node(node) {}
+
+        const Node* node = nullptr;
+    };
+
+    using const_iterator = ConstIterator;
+
+    /**
+     * @brief Секция чтения: пока объект жив, узлы, которые можно из него увидеть, не освобождаются
+     * @details Обход видит каждый элемент, который был в списке всё время обхода; элементы,
+     *      вставленные или удалённые во время обхода, могут встретиться или нет. Секцию нельзя
+     *      передавать в другой поток, а внутри неё нельзя вызывать ```synchronize()```
+     */
+    class ReadView {
+        friend class RcuList;
+
+    public:
+        ReadView(const ReadView&) = delete;
+        ReadView& operator=(const ReadView&) = delete;
+
+        ~ReadView() { EpochDomain::instance().leave(); }
+
+        ConstIterator begin() const { return begin_; }
+        ConstIterator end() const { return ConstIterator(); }
+
+    private:
+        explicit ReadView(const RcuList& list) {
+            EpochDomain::instance().enter();
+            begin_ = ConstIterator(list._first.load(std::memory_order_acquire));
+        }
+
+        ConstIterator begin_;
+    };
+
+    /// @brief Создаёт пустой список
+    /// @param alloc Аллокатор
+    explicit RcuList(const Alloc& alloc = Alloc());
+
+    /// @brief Освобождает все узлы; не должен выполняться параллельно с другими методами
+    ~RcuList();
+
+    RcuList(const RcuList&) = delete;
+    RcuList& operator=(const RcuList&) = delete;
+
+    /// @brief Открывает секцию чтения для обхода
+    /// @return Объект с ```begin()```/```end()```
+    ReadView read() const;
+
+    /**
+     * @brief Вызывает ```f``` для каждого элемента в одной секции чтения
+     * @param f Функция от ```const T&```
+     */
+    template <typename F>
+    void for_each(F f) const;
+
+    /**
+     * @brief Ищет первый элемент, удовлетворяющий предикату
+     * @param pred Предикат
+     * @return Копия найденного элемента или ```std::nullopt```
+     */
+    template <typename Pred>
+    std::optional<T> find_if(Pred pred) const;
+
+    /// @brief Проверка наличия элемента
+    /// @param value Искомое значение
+    /// @return ```true```, если элемент найден
+    bool contains(const T& value) const;
+
+    /// @brief Добавление в начало списка
+    /// @param data Добавляемые данные
+    void push_front(const T& data);
+
+    /// @brief Добавление в начало списка перемещением
+    /// @param data Перемещаемые данные
+    void push_front(T&& data);
+
+    /// @brief Добавление в конец списка
+    /// @param data Добавляемые данные
+    void push_back(const T& data);
+
+    /// @brief Добавление в конец списка перемещением
+    /// @param data Перемещаемые данные
+    void push_back(T&& data);
+
+    /// @brief Конструирует элемент в начале списка
+    /// @param args Аргументы конструктора элемента
+    template <typename... Args>
+    void emplace_front(Args&&... args);
+
+    /// @brief Конструирует элемент в конце списка
+    /// @param args Аргументы конструктора элемента
+    template <typename... Args>
+    void emplace_back(Args&&... args);
+
+    /// @brief Удаляет все элементы, равные ```value```
+    /// @param value Удаляемое значение
+    /// @return Количество удалённых элементов
+    size_t remove(const T& value);
+
+    /**
+     * @brief Удаляет все элементы, удовлетворяющие предикату
+     * @details Предикат вызывается под мьютексом писателей. Если он бросил исключение,
+     *      уже вырезанные узлы остаются вырезанными и освобождаются после секций чтения
+     * @param pred Предикат
+     * @return Количество удалённых элементов
+     */
+    template <typename Pred>
+    size_t remove_if(Pred pred);
+
+    /// @brief Удаляет все элементы
+    void clear();
+
+    /// @brief Ждёт завершения секций чтения, начатых до вызова, и освобождает удалённые узлы
+    /// @details Нельзя вызывать внутри секции чтения текущего потока
+    void synchronize();
+
+    /// @brief Количество удалённых, но ещё не освобождённых узлов
+    size_t pending_reclaim();
+
+    /// @brief Количество элементов
+    /// @return Снимок размера; при параллельных изменениях сразу устаревает
+    size_t size() const;
+
+    /// @brief Проверка на наличие элементов
+    /// @return Снимок: ```true```, если элементов нет
+    bool empty() const;
+
+    /// @brief Возвращает копию аллокатора списка
+    /// @return Аллокатор элементов
+    Alloc get_allocator() const;
+};
+
+template <typename T, typename Alloc>
+RcuList<T, Alloc>::RcuList(const Alloc& alloc) : _alloc(alloc) {}
+
+template <typename T, typename Alloc>
+RcuList<T, Alloc>::~RcuList() {
+    Node* current = _first.load(std::memory_order_relaxed);
+    while (current != nullptr) {
+        Node* next = current->nextP.load(std::memory_order_relaxed);
+        destroyNode(current);
+        current = next;
+    }
+    for (const Retired& retired : _retired) {
+        destroyNode(retired.node);
+    }
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+typename RcuList<T, Alloc>::Node* RcuList<T, Alloc>::createNode(Args&&... args) {
+    Node* node = NodeAllocTraits::allocate(_alloc, 1);
+    ::new (static_cast<void*>(node)) Node();
+    try {
+        Alloc valueAlloc(_alloc);
+        ValueAllocTraits::construct(valueAlloc, std::addressof(node->data), std::forward<Args>(args)...);
+    }
+    catch (...) {
+        node->~Node();
+        NodeAllocTraits::deallocate(_alloc, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::destroyNode(Node* node) {
+    Alloc valueAlloc(_alloc);
+    ValueAllocTraits::destroy(valueAlloc, std::addressof(node->data));
+    node->~Node();
+    NodeAllocTraits::deallocate(_alloc, node, 1);
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::linkEnd(bool front, Node* node) {
+    if (front) {
+        Node* first = _first.load(std::memory_order_relaxed);
+        node->nextP.store(first, std::memory_order_relaxed);
+        if (first != nullptr) {
+            first->prevP = node;
+        }
+        else {
+            _last = node;
+        }
+        _first.store(node, std::memory_order_release);
+    }
+    else {
+        node->prevP = _last;
+        if (_last != nullptr) {
+            _last->nextP.store(node, std::memory_order_release);
+        }
+        else {
+            _first.store(node, std::memory_order_release);
+        }
+        _last = node;
+    }
+    _count.store(_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::unlink(Node* node) {
+    Node* next = node->nextP.load(std::memory_order_relaxed);
+    if (node->prevP != nullptr) {
+        node->prevP->nextP.store(next, std::memory_order_release);
+    }
+    else {
+        _first.store(next, std::memory_order_release);
+    }
+    if (next != nullptr) {
+        next->prevP = node->prevP;
+    }
+    else {
+        _last = node->prevP;
+    }
+    _count.store(_count.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::retire(size_t from) {
+    if (from == _retired.size()) {
+        return;
+    }
+    // читатель, объявивший более позднюю эпоху, прочёл её после вырезания и узлов уже не увидит
+    uint64_t epoch = EpochDomain::instance().advance();
+    for (size_t i = from; i < _retired.size(); ++i) {
+        _retired[i].epoch = epoch;
+    }
+    if (_retired.size() >= reclaimThreshold) {
+        reclaim();
+    }
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::reclaim() {
+    uint64_t oldest = EpochDomain::instance().oldestActive();
+    auto firstKept = std::find_if(_retired.begin(), _retired.end(),
+                                  [oldest](const Retired& retired) { return retired.epoch >= oldest; });
+    for (auto it = _retired.begin(); it != firstKept; ++it) {
+        destroyNode(it->node);
+    }
+    _retired.erase(_retired.begin(), firstKept);
+}
+
+template <typename T, typename Alloc>
+typename RcuList<T, Alloc>::ReadView RcuList<T, Alloc>::read() const {
+    return ReadView(*this);
+}
+
+template <typename T, typename Alloc>
+template <typename F>
+void RcuList<T, Alloc>::for_each(F f) const {
+    ReadView view = read();
+    for (const T& value : view) {
+        f(value);
+    }
+}
+
+template <typename T, typename Alloc>
+template <typename Pred>
+std::optional<T> RcuList<T, Alloc>::find_if(Pred pred) const {
+    ReadView view = read();
+    for (const T& value : view) {
+        if (pred(value)) {
+            return value;
+        }
+    }
+    return std::nullopt;
+}
+
+template <typename T, typename Alloc>
+bool RcuList<T, Alloc>::contains(const T& value) const {
+    ReadView view = read();
+    return std::find(view.begin(), view.end(), value) != view.end();
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::push_front(T&& data) {
+    emplace_front(std::move(data));
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+void RcuList<T, Alloc>::emplace_front(Args&&... args) {
+    Node* node = createNode(std::forward<Args>(args)...);
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    linkEnd(true, node);
+}
+
+template <typename T, typename Alloc>
+template <typename... Args>
+void RcuList<T, Alloc>::emplace_back(Args&&... args) {
+    Node* node = createNode(std::forward<Args>(args)...);
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    linkEnd(false, node);
+}
+
+template <typename T, typename Alloc>
+size_t RcuList<T, Alloc>::remove(const T& value) {
+    return remove_if([&value](const T& data) { return data == value; });
+}
+
+template <typename T, typename Alloc>
+template <typename Pred>
+size_t RcuList<T, Alloc>::remove_if(Pred pred) {
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    size_t from = _retired.size();
+    Node* current = _first.load(std::memory_order_relaxed);
+    try {
+        while (current != nullptr) {
+            Node* next = current->nextP.load(std::memory_order_relaxed);
+            if (pred(std::as_const(current->data))) {
+                _retired.push_back({current, 0});
+                unlink(current);
+            }
+            current = next;
+        }
+    }
+    catch (...) {
+        // без эпохи вырезанные узлы освободил бы первый же reclaim, пока их читают
+        retire(from);
+        throw;
+    }
+    size_t removed = _retired.size() - from;
+    retire(from);
+    return removed;
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::clear() {
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    size_t from = _retired.size();
+    Node* current = _first.load(std::memory_order_relaxed);
+    // одной записи достаточно, чтобы новые читатели увидели пустой список
+    _first.store(nullptr, std::memory_order_release);
+    _last = nullptr;
+    _count.store(0, std::memory_order_relaxed);
+    while (current != nullptr) {
+        _retired.push_back({current, 0});
+        current = current->nextP.load(std::memory_order_relaxed);
+    }
+    retire(from);
+}
+
+template <typename T, typename Alloc>
+void RcuList<T, Alloc>::synchronize() {
+    std::unique_lock<std::mutex> lock(_writeMutex);
+    if (_retired.empty()) {
+        return;
+    }
+    uint64_t last = _retired.back().epoch;
+    while (EpochDomain::instance().oldestActive() <= last) {
+        lock.unlock();
+        std::this_thread::yield();
+        lock.lock();
+    }
+    reclaim();
+}
+
+template <typename T, typename Alloc>
+size_t RcuList<T, Alloc>::pending_reclaim() {
+    std::lock_guard<std::mutex> lock(_writeMutex);
+    return _retired.size();
+}
+
+template <typename T, typename Alloc>
+size_t RcuList<T, Alloc>::size() const {
+    return _count.load(std::memory_order_relaxed);
+}
+
+template <typename T, typename Alloc>
+bool RcuList<T, Alloc>::empty() const {
+    return size() == 0;
+}
+
+template <typename T, typename Alloc>
+Alloc RcuList<T, Alloc>::get_allocator() const {
+    return Alloc(_alloc);
+}
@@ -0,0 +1,195 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <unistd.h>
+
+/**
+ * @brief Записывает ```size``` байт в поток
+ * @param out Поток
+ * @param data Данные
+ * @param size Количество байт
+ * @exception std::runtime_error Если запись не удалась
+ */
+inline void writeBytes(std::ostream& out, const void* data, size_t size) {
+    if (!out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size))) {
+        throw std::runtime_error("Failed to write list stream");
+    }
+}
+
+/**
+ * @brief Читает ровно ```size``` байт из потока
+ * @param in Поток
+ * @param data Куда читать
+ * @param size Количество байт
+ * @exception std::runtime_error Если поток закончился раньше
+ */
+inline void readBytes(std::istream& in, void* data, size_t size) {
+    if (!in.read(static_cast<char*>(data), static_cast<std::streamsize>(size))) {
+        throw std::runtime_error("Unexpected end of list stream");
+    }
+}
+
+/**
+ * @brief Точка настройки двоичной записи элементов ```List::save```/```List::load```
+ * @details Тривиально копируемые типы пишутся блоками байт и в специализации
+ *      не нуждаются. Для остальных типов нужна специализация с методами
+ *      ```static void save(std::ostream&, const T&)``` и ```static T load(std::istream&)```
+ * @tparam T Тип элемента
+ */
+template <typename T, typename = void>
+struct ListSerializer;
+
+/// @brief Строки пишутся как длина и символы
+template <typename CharT, typename Traits, typename Alloc>
+struct ListSerializer<std::basic_string<CharT, Traits, Alloc>,
+                      std::enable_if_t<std::is_trivially_copyable_v<CharT>>> {
+    static void save(std::ostream& out, const std::basic_string<CharT, Traits, Alloc>& value) {
+        uint64_t length = value.size();
+        writeBytes(out, &length, sizeof(length));
+        writeBytes(out, value.data(), length * sizeof(CharT));
+    }
+
+    static std::basic_string<CharT, Traits, Alloc> load(std::istream& in) {
+        uint64_t length = 0;
+        readBytes(in, &length, sizeof(length));
+        std::basic_string<CharT, Traits, Alloc> value;
+        // длина не проверена, поэтому строка растёт по мере чтения, а не выделяется сразу
+        constexpr size_t chunk = 4096;
+        for (uint64_t done = 0; done < length;) {
+            size_t part = static_cast<size_t>(std::min<uint64_t>(chunk, length - done));
+            value.resize(static_cast<size_t>(done) + part);
+            readBytes(in, value.data() + done, part * sizeof(CharT));
+            done += part;
+        }
+        return value;
+    }
+};
+
+/**
+ * @brief Буфер потока поверх файлового дескриптора
+ * @details Используется либо для чтения, либо для записи. Большие блоки
+ *      читаются и пишутся мимо буфера. Ошибки системных вызовов бросаются
+ *      как ```std::system_error```; дескриптор не закрывается
+ */
+class FdStreamBuf : public std::streambuf {
+public:
+    /// @brief Создаёт буфер над ```fd```
+    /// @param fd Открытый файловый дескриптор
+    explicit FdStreamBuf(int fd) : fd(fd) {
+        setg(buffer, buffer, buffer);
+        setp(buffer, buffer + bufferSize);
+    }
+
+protected:
+    int_type underflow() override {
+        size_t got = readSome(buffer, bufferSize);
+        if (got == 0) {
+            return traits_type::eof();
+        }
+        setg(buffer, buffer, buffer + got);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    std::streamsize xsgetn(char* data, std::streamsize count) override {
+        std::streamsize done = std::min<std::streamsize>(count, egptr() - gptr());
+        std::copy(gptr(), gptr() + done, data);
+        gbump(static_cast<int>(done));
+        while (done < count) {
+            if (count - done < static_cast<std::streamsize>(bufferSize)) {
+                if (traits_type::eq_int_type(underflow(), traits_type::eof())) {
+                    break;
+                }
+                std::streamsize part = std::min<std::streamsize>(count - done, egptr() - gptr());
+                std::copy(gptr(), gptr() + part, data + done);
+                gbump(static_cast<int>(part));
+                done += part;
+            }
+            else {
+                size_t got = readSome(data + done, static_cast<size_t>(count - done));
+                if (got == 0) {
+                    break;
+                }
+                done += static_cast<std::streamsize>(got);
+            }
+        }
+        return done;
+    }
+
+    int_type overflow(int_type ch) override {
+        flushBuffer();
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize count) override {
+        if (count < epptr() - pptr()) {
+            std::copy(data, data + count, pptr());
+            pbump(static_cast<int>(count));
+            return count;
+        }
+        flushBuffer();
+        writeAll(data, static_cast<size_t>(count));
+        return count;
+    }
+
+    int sync() override {
+        flushBuffer();
+        return 0;
+    }
+
+private:
+    /// @brief Читает до ```size``` байт; 0 - конец файла
+    size_t readSome(char* data, size_t size) {
+        ssize_t got;
+        do {
+            got = ::read(fd, data, size);
+        } while (got < 0 && errno == EINTR);
+        if (got < 0) {
+            throw std::system_error(errno, std::generic_category(), "read");
+        }
+        return static_cast<size_t>(got);
+    }
+
+    /// @brief Пишет все ```size``` байт
+    void writeAll(const char* data, size_t size) {
+        while (size > 0) {
+            ssize_t written = ::write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "write");
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+    }
+
+    /// @brief Сбрасывает накопленные в буфере байты
+    void flushBuffer() {
+        char* end = pptr();
+        setp(buffer, buffer + bufferSize);
+        writeAll(buffer, static_cast<size_t>(end - buffer));
+    }
+
+    /// @brief Размер буфера
+    static constexpr size_t bufferSize = 1 << 16;
+
+    /// @brief Файловый дескриптор
+    int fd;
+
+    /// @brief Буфер чтения или записи
+    char buffer[bufferSize];
+};
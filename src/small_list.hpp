@@ -0,0 +1,261 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "list.hpp"
+
+/**
+ * @brief Встроенный пул на ```N``` узлов списка элементов ```T```
+ * @details Занятые ячейки отмечаются битовой маской, поэтому выделение и
+ *      освобождение - несколько инструкций без обращения к куче
+ * @tparam T Тип элементов списка
+ * @tparam N Количество ячеек (от 1 до 64)
+ */
+template <typename T, size_t N>
+class InlineNodeArena {
+    static_assert(N > 0 && N <= 64, "InlineNodeArena holds from 1 to 64 nodes");
+
+    /// @brief Раскладка узла ```List```: два указателя и элемент
+    struct NodeLayout {
+        void* prevP;
+        void* nextP;
+        T data;
+    };
+
+public:
+    /// @brief Размер ячейки
+    static constexpr size_t slotSize = sizeof(NodeLayout);
+
+    /// @brief Выравнивание ячеек
+    static constexpr size_t slotAlign = alignof(NodeLayout);
+
+    /// @brief Помещается ли объект ```U``` в ячейку
+    template <typename U>
+    static constexpr bool fits = sizeof(U) <= slotSize && alignof(U) <= slotAlign;
+
+    InlineNodeArena() = default;
+    InlineNodeArena(const InlineNodeArena&) = delete;
+    InlineNodeArena& operator=(const InlineNodeArena&) = delete;
+
+    /// @brief Занимает свободную ячейку
+    /// @return Указатель на ячейку или ```nullptr```, если свободных нет
+    void* take() {
+        if (freeMask == 0) {
+            return nullptr;
+        }
+        size_t index = static_cast<size_t>(std::countr_zero(freeMask));
+        freeMask &= freeMask - 1;
+        return storage + index * slotSize;
+    }
+
+    /// @brief Освобождает ячейку
+    /// @param slot Указатель, полученный от ```take```
+    void give(void* slot) {
+        size_t index = static_cast<size_t>(static_cast<unsigned char*>(slot) - storage) / slotSize;
+        freeMask |= uint64_t(1) << index;
+    }
+
+    /// @brief Принадлежит ли указатель пулу
+    /// @param p Указатель
+    /// @return ```true```, если ```p``` указывает внутрь пула
+    bool owns(const void* p) const {
+        std::less<const void*> less;
+        return !less(p, storage) && less(p, storage + N * slotSize);
+    }
+
+    /// @brief Количество свободных ячеек
+    size_t available() const {
+        return static_cast<size_t>(std::popcount(freeMask));
+    }
+
+private:
+    /// @brief Ячейки
+    alignas(slotAlign) unsigned char storage[N * slotSize];
+
+    /// @brief Свободные ячейки: бит ```i``` установлен, если ячейка ```i``` свободна
+    uint64_t freeMask = N == 64 ? ~uint64_t(0) : (uint64_t(1) << N) - 1;
+};
+
+/**
+ * @brief Аллокатор, отдающий одиночные объекты из встроенного пула, а остальное - из кучи
+ * @details Аллокаторы равны, только если ссылаются на один пул, и не распространяются
+ *      при копировании, перемещении и обмене: узлы пула нельзя передать другому списку.
+ *      Аллокатор без пула (по умолчанию и при копировании контейнера) работает только с кучей
+ * @tparam U Тип выделяемых объектов
+ * @tparam Arena Тип пула
+ */
+template <typename U, typename Arena>
+class InlineAllocator {
+    template <typename, typename> friend class InlineAllocator;
+
+public:
+    using value_type = U;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    /// @brief Аллокатор без пула
+    InlineAllocator() noexcept = default;
+
+    /// @brief Аллокатор поверх пула
+    /// @param arena Пул; ```nullptr``` - только куча
+    explicit InlineAllocator(Arena* arena) noexcept : arena(arena) {}
+
+    /// @brief Перепривязка к другому типу с тем же пулом
+    /// @param other Исходный аллокатор
+    template <typename V>
+    InlineAllocator(const InlineAllocator<V, Arena>& other) noexcept : arena(other.arena) {}
+
+    /// @brief Выделяет память под ```count``` объектов
+    /// @param count Количество объектов
+    /// @return Указатель на память
+    U* allocate(size_t count) {
+        if constexpr (Arena::template fits<U>) {
+            if (count == 1 && arena != nullptr) {
+                if (void* slot = arena->take()) {
+                    return static_cast<U*>(slot);
+                }
+            }
+        }
+        return std::allocator<U>().allocate(count);
+    }
+
+    /// @brief Освобождает память, выделенную ```allocate```
+    /// @param p Указатель на память
+    /// @param count Количество объектов
+    void deallocate(U* p, size_t count) {
+        if (arena != nullptr && arena->owns(p)) {
+            arena->give(p);
+            return;
+        }
+        std::allocator<U>().deallocate(p, count);
+    }
+
+    /// @brief Копия контейнера не должна делить пул с оригиналом
+    /// @return Аллокатор без пула
+    InlineAllocator select_on_container_copy_construction() const {
+        return InlineAllocator();
+    }
+
+    template <typename V>
+    bool operator==(const InlineAllocator<V, Arena>& other) const noexcept { return arena == other.arena; }
+
+    template <typename V>
+    bool operator!=(const InlineAllocator<V, Arena>& other) const noexcept { return arena != other.arena; }
+
+private:
+    /// @brief Пул; ```nullptr``` - только куча
+    Arena* arena = nullptr;
+};
+
+/// @brief Хранилище пула ```SmallList```; базовый класс, чтобы пул создавался раньше списка
+template <typename T, size_t N>
+struct SmallListStorage {
+    InlineNodeArena<T, N> _arena;
+};
+
+/**
+ * @brief Список, первые ```N``` узлов которого лежат внутри самого объекта
+ * @details Узлы сверх ```N``` выделяются в куче; освободившиеся встроенные ячейки
+ *      переиспользуются. Интерфейс тот же, что у ```List```. Узлы пула не могут
+ *      перейти в другой список, поэтому перемещение, обмен и ```splice``` между
+ *      двумя ```SmallList``` переносят элементы поштучно (O(n)), а итераторы
+ *      перемещённого списка становятся недействительными
+ * @tparam T Тип хранимых элементов
+ * @tparam N Количество встроенных узлов (от 1 до 64)
+ * @tparam Stats Политика статистики
+ */
+template <typename T, size_t N = 8, typename Stats = NoListStats>
+class SmallList : private SmallListStorage<T, N>,
+                  public List<T, InlineAllocator<T, InlineNodeArena<T, N>>, Stats> {
+    using Storage = SmallListStorage<T, N>;
+    using Base = List<T, InlineAllocator<T, InlineNodeArena<T, N>>, Stats>;
+
+    static_assert(sizeof(typename Base::Node) <= InlineNodeArena<T, N>::slotSize
+                  && alignof(typename Base::Node) <= InlineNodeArena<T, N>::slotAlign,
+                  "List node does not fit InlineNodeArena slot");
+
+public:
+    using allocator_type = typename Base::allocator_type;
+
+    /// @brief Количество встроенных узлов
+    static constexpr size_t inline_capacity = N;
+
+    /// @brief Создаёт пустой список
+    SmallList() : Base(allocator_type(&this->_arena)) {}
+
+    /**
+     * @brief Заполняет список ```count``` копиями ```value```
+     * @param count Количество элементов
+     * @param value Значение
+     */
+    SmallList(size_t count, const T& value) : Base(count, value, allocator_type(&this->_arena)) {}
+
+    /// @brief Заполняет список значениями из ```std::initializer_list<T>```
+    /// @param initList Список инициализации
+    SmallList(std::initializer_list<T> initList) : Base(initList, allocator_type(&this->_arena)) {}
+
+    /// @brief Конструктор копирования; копия заполняет свой пул
+    /// @param other Копируемый список
+    SmallList(const SmallList& other) : Storage(), Base(other, allocator_type(&this->_arena)) {}
+
+    /// @brief Конструктор перемещения; элементы перемещаются поштучно в свой пул
+    /// @param other Перемещаемый список
+    SmallList(SmallList&& other) : Storage(), Base(std::move(other), allocator_type(&this->_arena)) {}
+
+    /// @brief Оператор копирующего присваивания
+    /// @details Старые элементы удаляются до копирования, чтобы копия заняла
+    ///     освободившиеся встроенные узлы; при исключении список остаётся частично заполненным
+    /// @param other Копируемый список
+    /// @return Ссылка на текущий список
+    SmallList& operator=(const SmallList& other) {
+        if (this != &other) {
+            this->clear();
+            Base::operator=(other);
+        }
+        return *this;
+    }
+
+    /// @brief Оператор перемещающего присваивания; элементы перемещаются поштучно
+    /// @param other Перемещаемый список
+    /// @return Ссылка на текущий список
+    SmallList& operator=(SmallList&& other) {
+        Base::operator=(std::move(other));
+        return *this;
+    }
+
+    /// @brief Обмен содержимым; элементы перемещаются поштучно
+    /// @param other Список для обмена
+    void swap(SmallList& other) {
+        if (this == &other) {
+            return;
+        }
+        // у List::swap временный список делил бы пул с одним из списков и занимал его ячейки
+        SmallList tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    /// @brief Делит список, как ```List::partition```
+    /// @details Возвращаемый список не должен делить пул с текущим, поэтому он
+    ///     получает аллокатор без пула, а отвергнутые элементы перемещаются поштучно
+    /// @param pred Предикат
+    /// @return Список отвергнутых элементов
+    template <typename Pred>
+    Base partition(Pred pred) {
+        return Base::partition(std::move(pred), allocator_type());
+    }
+
+    /// @brief Количество свободных встроенных узлов
+    /// @return Сколько элементов ещё можно добавить без обращения к куче
+    size_t inline_available() const {
+        return this->_arena.available();
+    }
+};
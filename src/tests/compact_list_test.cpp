@@ -0,0 +1,113 @@
+#include "compact_list_test.hpp"
+
+TEST_F(CompactListFixture, push_pop_test) {
+    EXPECT_TRUE(empty_List.empty());
+    EXPECT_THROW(empty_List.front(), std::out_of_range);
+    EXPECT_THROW(empty_List.pop_back(), std::out_of_range);
+
+    for (int i = 0; i < 10; ++i) {
+        empty_List.push_back(i);
+        empty_List.push_front(-i);
+    }
+    EXPECT_EQ(empty_List.size(), 20);
+    EXPECT_EQ(empty_List.front(), -9);
+    EXPECT_EQ(empty_List.back(), 9);
+    empty_List.pop_front();
+    empty_List.pop_back();
+    EXPECT_EQ(empty_List.front(), -8);
+    EXPECT_EQ(empty_List.back(), 8);
+    EXPECT_EQ(*--empty_List.end(), 8);
+}
+
+TEST_F(CompactListFixture, iterators_survive_growth_test) {
+    CompactList<int> list;
+    list.push_back(1);
+    auto first = list.begin();
+    size_t capacity = list.capacity();
+    for (int i = 2; i <= 1000; ++i) {
+        list.push_back(i);
+    }
+    EXPECT_GT(list.capacity(), capacity);
+    EXPECT_EQ(*first, 1);
+    EXPECT_EQ(list.size(), 1000);
+    EXPECT_EQ(*std::next(first, 999), 1000);
+
+    auto it = list.insert(std::next(first, 10), 42);
+    EXPECT_EQ(*std::prev(it), 10);
+    EXPECT_EQ(*std::next(it), 11);
+}
+
+TEST_F(CompactListFixture, free_slots_reused_test) {
+    CompactList<int> list;
+    list.reserve(100);
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+    }
+    size_t capacity = list.capacity();
+    for (auto it = list.begin(); it != list.end();) {
+        it = list.erase(it);
+        if (it != list.end()) {
+            ++it;
+        }
+    }
+    EXPECT_EQ(list.size(), 50);
+    for (int i = 0; i < 50; ++i) {
+        list.push_front(-i);
+    }
+    EXPECT_EQ(list.capacity(), capacity);
+    EXPECT_EQ(list.size(), 100);
+    EXPECT_EQ(list.front(), -49);
+    EXPECT_EQ(list.back(), 99);
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.capacity(), capacity);
+}
+
+TEST_F(CompactListFixture, random_ops_test) {
+    CompactList<int> list;
+    std::list<int> model;
+    unsigned seed = 7;
+    for (int step = 0; step < 5000; ++step) {
+        seed = seed * 1103515245 + 12345;
+        unsigned op = (seed >> 16) % 5;
+        size_t pos = model.empty() ? 0 : (seed >> 8) % model.size();
+        if (op < 3 || model.empty()) {
+            list.insert(std::next(list.begin(), pos), step);
+            model.insert(std::next(model.begin(), pos), step);
+        }
+        else {
+            list.erase(std::next(list.begin(), pos));
+            model.erase(std::next(model.begin(), pos));
+        }
+    }
+    EXPECT_EQ(toVector(list), std::vector<int>(model.begin(), model.end()));
+
+    list.sort();
+    model.sort();
+    EXPECT_EQ(toVector(list), std::vector<int>(model.begin(), model.end()));
+    list.reverse();
+    model.reverse();
+    EXPECT_EQ(toVector(list), std::vector<int>(model.begin(), model.end()));
+    EXPECT_EQ(std::vector<int>(list.rbegin(), list.rend()), std::vector<int>(model.rbegin(), model.rend()));
+}
+
+TEST_F(CompactListFixture, copy_move_strings_test) {
+    CompactList<std::string> strings{"b", "a", "c"};
+    strings.emplace_back(40, 'z');
+    CompactList<std::string> copy = strings;
+    EXPECT_EQ(copy, strings);
+
+    CompactList<std::string> moved = std::move(copy);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved, strings);
+
+    moved.sort([](const std::string& left, const std::string& right) { return left.size() > right.size(); });
+    EXPECT_EQ(moved.front(), std::string(40, 'z'));
+    EXPECT_EQ(toVector(moved), std::vector<std::string>({std::string(40, 'z'), "b", "a", "c"}));
+
+    copy = moved;
+    copy.erase(copy.begin(), std::next(copy.begin(), 2));
+    EXPECT_EQ(toVector(copy), std::vector<std::string>({"a", "c"}));
+    EXPECT_NE(copy, moved);
+}
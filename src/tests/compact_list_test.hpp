@@ -0,0 +1,12 @@
+#include <gtest/gtest.h>
+#include "compact_list.hpp"
+#include "test_helpers.hpp"
+#include <list>
+#include <string>
+#include <vector>
+
+class CompactListFixture : public ::testing::Test {
+protected:
+    CompactList<int> empty_List{};
+    CompactList<int> ininList_List{1, 2, 3, 4};
+};
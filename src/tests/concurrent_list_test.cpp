@@ -0,0 +1,119 @@
+#include "concurrent_list_test.hpp"
+
+TEST_F(ConcurrentListFixture, single_thread_test) {
+    int out = 0;
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(list.try_pop_front(out));
+    EXPECT_FALSE(list.try_pop_back(out));
+
+    for (int i = 1; i <= 5; ++i) {
+        list.push_back(i);
+        list.push_front(-i);
+    }
+    EXPECT_EQ(list.size(), 10);
+
+    for (int i = 5; i >= 1; --i) {
+        EXPECT_TRUE(list.try_pop_front(out));
+        EXPECT_EQ(out, -i);
+        EXPECT_TRUE(list.try_pop_back(out));
+        EXPECT_EQ(out, i);
+    }
+    EXPECT_TRUE(list.empty());
+
+    ConcurrentList<std::string> strings;
+    strings.emplace_back(3, 'a');
+    strings.emplace_front("b");
+    std::string str;
+    EXPECT_TRUE(strings.wait_pop_back(str));
+    EXPECT_EQ(str, "aaa");
+    EXPECT_TRUE(strings.wait_pop_back(str));
+    EXPECT_EQ(str, "b");
+}
+
+TEST_F(ConcurrentListFixture, contention_stress_test) {
+    std::atomic<long long> popped_sum{0};
+    std::atomic<int> popped_count{0};
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadsCount; ++t) {
+        threads.emplace_back([this, t] {
+            for (int i = 1; i <= itemsPerThread; ++i) {
+                if ((i + t) % 2 == 0) {
+                    list.push_back(i);
+                }
+                else {
+                    list.push_front(i);
+                }
+            }
+        });
+        threads.emplace_back([this, t, &popped_sum, &popped_count] {
+            int out = 0;
+            int misses = 0;
+            while (popped_count.load() < threadsCount * itemsPerThread && misses < 1000000) {
+                bool ok = (t % 2 == 0) ? list.try_pop_front(out) : list.try_pop_back(out);
+                if (ok) {
+                    popped_sum += out;
+                    ++popped_count;
+                    misses = 0;
+                }
+                else {
+                    ++misses;
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    long long expected = static_cast<long long>(itemsPerThread) * (itemsPerThread + 1) / 2 * threadsCount;
+    EXPECT_EQ(popped_count.load(), threadsCount * itemsPerThread);
+    EXPECT_EQ(popped_sum.load(), expected);
+    EXPECT_TRUE(list.empty());
+}
+
+TEST_F(ConcurrentListFixture, wait_pop_test) {
+    std::atomic<long long> popped_sum{0};
+    std::atomic<int> popped_count{0};
+    std::vector<std::thread> consumers;
+
+    for (int t = 0; t < threadsCount; ++t) {
+        consumers.emplace_back([this, t, &popped_sum, &popped_count] {
+            int out = 0;
+            while ((t % 2 == 0) ? list.wait_pop_front(out) : list.wait_pop_back(out)) {
+                popped_sum += out;
+                ++popped_count;
+            }
+        });
+    }
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threadsCount; ++t) {
+        producers.emplace_back([this] {
+            for (int i = 1; i <= itemsPerThread; ++i) {
+                list.push_back(i);
+            }
+        });
+    }
+    for (auto& thread : producers) {
+        thread.join();
+    }
+    while (!list.empty()) {
+        std::this_thread::yield();
+    }
+    list.close();
+    for (auto& thread : consumers) {
+        thread.join();
+    }
+
+    long long expected = static_cast<long long>(itemsPerThread) * (itemsPerThread + 1) / 2 * threadsCount;
+    EXPECT_EQ(popped_count.load(), threadsCount * itemsPerThread);
+    EXPECT_EQ(popped_sum.load(), expected);
+
+    int out = 0;
+    EXPECT_TRUE(list.closed());
+    EXPECT_FALSE(list.wait_pop_front(out));
+    list.push_back(7);
+    EXPECT_TRUE(list.wait_pop_front(out));
+    EXPECT_EQ(out, 7);
+}
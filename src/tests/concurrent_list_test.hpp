@@ -0,0 +1,14 @@
+#include <gtest/gtest.h>
+#include "concurrent_list.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ConcurrentListFixture : public ::testing::Test {
+protected:
+    ConcurrentList<int> list{};
+
+    static constexpr int threadsCount = 8;
+    static constexpr int itemsPerThread = 20000;
+};
@@ -0,0 +1,122 @@
+#include "cow_list_test.hpp"
+
+TEST_F(CowListFixture, copy_shares_test) {
+    CowList<int> original = iota(1000);
+    CowList<int> copy(original);
+    EXPECT_TRUE(original.shared());
+    EXPECT_TRUE(copy.shared());
+    EXPECT_EQ(&std::as_const(copy).front(), &std::as_const(original).front());
+
+    // чтение через константные итераторы не отделяет копию
+    long sum = 0;
+    for (int value : std::as_const(copy)) {
+        sum += value;
+    }
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+    EXPECT_TRUE(copy.shared());
+
+    CowList<int> assigned;
+    assigned = copy;
+    EXPECT_EQ(&std::as_const(assigned).back(), &std::as_const(original).back());
+    EXPECT_EQ(assigned, original);
+}
+
+TEST_F(CowListFixture, detach_segment_test) {
+    CowList<int> original = iota(1000);
+    CowList<int> copy(original);
+
+    copy.push_back(1000);
+    EXPECT_FALSE(original.shared());
+    EXPECT_FALSE(copy.shared());
+    EXPECT_EQ(original.size(), 1000);
+    EXPECT_EQ(original.back(), 999);
+    EXPECT_EQ(copy.size(), 1001);
+    EXPECT_EQ(copy.back(), 1000);
+    // скопирован только последний сегмент
+    EXPECT_EQ(&std::as_const(copy).front(), &std::as_const(original).front());
+    EXPECT_NE(&*std::prev(copy.cend(), 2), &std::as_const(original).back());
+
+    copy.front() = -1;
+    EXPECT_EQ(original.front(), 0);
+    EXPECT_EQ(copy.front(), -1);
+    EXPECT_NE(&std::as_const(copy).front(), &std::as_const(original).front());
+    EXPECT_EQ(&*std::next(copy.cbegin(), 500), &*std::next(original.cbegin(), 500));
+}
+
+TEST_F(CowListFixture, insert_erase_test) {
+    std::list<int> model;
+    CowList<int> list;
+    std::vector<CowList<int>> snapshots;
+    std::vector<std::list<int>> models;
+    unsigned seed = 12345;
+    for (int step = 0; step < 3000; ++step) {
+        seed = seed * 1103515245 + 12345;
+        size_t position = model.empty() ? 0 : (seed >> 8) % (model.size() + 1);
+        auto it = std::next(list.cbegin(), static_cast<std::ptrdiff_t>(position));
+        auto modelIt = std::next(model.begin(), static_cast<std::ptrdiff_t>(position));
+        if ((seed >> 4) % 3 != 0 || position == model.size()) {
+            auto inserted = list.insert(it, step);
+            model.insert(modelIt, step);
+            EXPECT_EQ(*inserted, step);
+        }
+        else {
+            auto next = list.erase(it);
+            modelIt = model.erase(modelIt);
+            EXPECT_EQ(next == list.cend(), modelIt == model.end());
+        }
+        if (step % 500 == 0) {
+            snapshots.push_back(list);
+            models.push_back(model);
+        }
+    }
+    EXPECT_EQ(list.size(), model.size());
+    EXPECT_EQ(toVector(list), std::vector<int>(model.begin(), model.end()));
+    std::vector<int> backwards(list.rbegin(), list.rend());
+    EXPECT_EQ(backwards, std::vector<int>(model.rbegin(), model.rend()));
+    for (size_t i = 0; i < snapshots.size(); ++i) {
+        EXPECT_EQ(toVector(snapshots[i]), std::vector<int>(models[i].begin(), models[i].end()));
+    }
+}
+
+TEST_F(CowListFixture, push_pop_test) {
+    CowList<std::string> list = {"b", "c"};
+    CowList<std::string> copy = list;
+    list.push_front("a");
+    list.emplace_back(2, 'd');
+    EXPECT_EQ(toVector(list), std::vector<std::string>({"a", "b", "c", "dd"}));
+    EXPECT_EQ(toVector(copy), std::vector<std::string>({"b", "c"}));
+
+    copy.pop_back();
+    copy.pop_front();
+    EXPECT_TRUE(copy.empty());
+    EXPECT_THROW(copy.pop_front(), std::out_of_range);
+    EXPECT_THROW(std::as_const(copy).back(), std::out_of_range);
+    EXPECT_EQ(list.size(), 4);
+
+    copy.swap(list);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(copy.front(), "a");
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(copy.cbegin(), copy.cend());
+}
+
+TEST_F(CowListFixture, sort_test) {
+    CowList<int> list;
+    for (int i = 0; i < 500; ++i) {
+        list.push_back((i * 7919) % 500);
+    }
+    CowList<int> copy = list;
+    list.sort();
+    std::vector<int> expected(500);
+    for (int i = 0; i < 500; ++i) {
+        expected[i] = i;
+    }
+    EXPECT_EQ(toVector(list), expected);
+    EXPECT_EQ(copy.front(), 0);
+    EXPECT_EQ(*std::next(copy.cbegin()), 7919 % 500);
+    copy.sort(std::greater<int>());
+    EXPECT_EQ(copy.front(), 499);
+    EXPECT_EQ(copy.back(), 0);
+    EXPECT_EQ(list.size(), 500);
+}
@@ -0,0 +1,19 @@
+#include <gtest/gtest.h>
+#include "cow_list.hpp"
+#include "test_helpers.hpp"
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+class CowListFixture : public ::testing::Test {
+protected:
+    /// @brief Список из чисел ```0, 1, ..., count - 1```
+    static CowList<int> iota(int count) {
+        CowList<int> list;
+        for (int i = 0; i < count; ++i) {
+            list.push_back(i);
+        }
+        return list;
+    }
+};
@@ -0,0 +1,98 @@
+#include "indexed_list_test.hpp"
+
+TEST_F(IndexedListFixture, at_index_of_test) {
+    EXPECT_THROW(empty_List.at(0), std::out_of_range);
+    EXPECT_THROW(empty_List.pop_front(), std::out_of_range);
+    EXPECT_EQ(empty_List.index_of(empty_List.end()), 0);
+
+    expectIndexed(ininList_List, {1, 2, 3, 4});
+    EXPECT_THROW(ininList_List.at(4), std::out_of_range);
+    ininList_List.at(2) = 30;
+    EXPECT_EQ(toVector(ininList_List), std::vector<int>({1, 2, 30, 4}));
+}
+
+TEST_F(IndexedListFixture, advance_test) {
+    for (int i = 0; i < 1000; ++i) {
+        empty_List.push_back(i);
+    }
+    auto it = empty_List.advance(empty_List.begin(), 500);
+    EXPECT_EQ(*it, 500);
+    EXPECT_EQ(*empty_List.advance(it, -250), 250);
+    EXPECT_EQ(empty_List.advance(it, 500), empty_List.end());
+    EXPECT_EQ(*(empty_List.end() - 1), 999);
+    EXPECT_EQ(*(empty_List.begin() + 999), 999);
+    EXPECT_THROW(empty_List.advance(it, 501), std::out_of_range);
+    EXPECT_THROW(empty_List.advance(it, -501), std::out_of_range);
+    EXPECT_THROW(empty_List.begin() - 1, std::out_of_range);
+}
+
+TEST_F(IndexedListFixture, random_ops_test) {
+    IndexedList<int> list;
+    std::vector<int> model;
+    unsigned seed = 7;
+    for (int step = 0; step < 5000; ++step) {
+        seed = seed * 1103515245 + 12345;
+        unsigned op = (seed >> 16) % 5;
+        size_t pos = (seed >> 8) % (model.size() + 1);
+        if (op < 3 || model.empty()) {
+            auto it = list.insert(list.begin() + pos, step);
+            model.insert(model.begin() + pos, step);
+            EXPECT_EQ(list.index_of(it), pos);
+        }
+        else {
+            pos %= model.size();
+            list.erase(list.begin() + pos);
+            model.erase(model.begin() + pos);
+        }
+        if (step % 500 == 0) {
+            expectIndexed(list, model);
+        }
+    }
+    expectIndexed(list, model);
+
+    list.erase(list.begin() + 10, list.begin() + 100);
+    model.erase(model.begin() + 10, model.begin() + 100);
+    expectIndexed(list, model);
+}
+
+TEST_F(IndexedListFixture, sort_reverse_keep_index_test) {
+    std::vector<int> model;
+    unsigned seed = 11;
+    for (int i = 0; i < 2000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        int value = static_cast<int>((seed >> 8) % 100);
+        empty_List.push_front(value);
+        model.insert(model.begin(), value);
+    }
+    empty_List.sort();
+    std::stable_sort(model.begin(), model.end());
+    expectIndexed(empty_List, model);
+
+    empty_List.reverse();
+    std::reverse(model.begin(), model.end());
+    expectIndexed(empty_List, model);
+
+    empty_List.push_back(-1);
+    model.push_back(-1);
+    expectIndexed(empty_List, model);
+}
+
+TEST_F(IndexedListFixture, copy_move_strings_test) {
+    IndexedList<std::string> strings{"b", "a", "c"};
+    strings.emplace_back(40, 'z');
+    IndexedList<std::string> copy = strings;
+    EXPECT_EQ(copy, strings);
+    expectIndexed(copy, {"b", "a", "c", std::string(40, 'z')});
+
+    IndexedList<std::string> moved = std::move(copy);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved, strings);
+    moved.pop_back();
+    moved.pop_front();
+    expectIndexed(moved, {"a", "c"});
+
+    copy = moved;
+    copy.push_front("x");
+    expectIndexed(copy, {"x", "a", "c"});
+    EXPECT_NE(copy, moved);
+}
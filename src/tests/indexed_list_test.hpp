@@ -0,0 +1,23 @@
+#include <gtest/gtest.h>
+#include "indexed_list.hpp"
+#include "test_helpers.hpp"
+#include <string>
+#include <vector>
+
+class IndexedListFixture : public ::testing::Test {
+protected:
+    IndexedList<int> empty_List{};
+    IndexedList<int> ininList_List{1, 2, 3, 4};
+
+    /// @brief Сверяет at и index_of каждого элемента с образцом
+    template <typename L>
+    static void expectIndexed(const L& list, const std::vector<typename L::value_type>& expected) {
+        ASSERT_EQ(list.size(), expected.size());
+        size_t index = 0;
+        for (auto it = list.begin(); it != list.end(); ++it, ++index) {
+            EXPECT_EQ(list.index_of(it), index);
+            EXPECT_EQ(list.at(index), expected[index]);
+        }
+        EXPECT_EQ(list.index_of(list.end()), list.size());
+    }
+};
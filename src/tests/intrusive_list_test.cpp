@@ -0,0 +1,107 @@
+#include "intrusive_list_test.hpp"
+
+TEST_F(IntrusiveListFixture, link_unlink_test) {
+    EXPECT_EQ(list.size(), 6);
+    EXPECT_EQ(ids(list), std::vector<int>({0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(&list.front(), &pool[0]);
+    EXPECT_EQ(&list.back(), &pool[5]);
+    EXPECT_EQ(&*--list.end(), &pool[5]);
+    EXPECT_THROW(list.push_back(pool[2]), std::out_of_range);
+
+    list.erase(pool[2]);
+    EXPECT_FALSE(pool[2].byDeadline.is_linked());
+    EXPECT_EQ(ids(list), std::vector<int>({0, 1, 3, 4, 5}));
+
+    list.push_front(pool[2]);
+    list.pop_back();
+    auto it = list.erase(list.iterator_to(pool[1]));
+    EXPECT_EQ(&*it, &pool[3]);
+    it = list.insert(it, pool[1]);
+    EXPECT_EQ(&*it, &pool[1]);
+    EXPECT_EQ(ids(list), std::vector<int>({2, 0, 1, 3, 4}));
+    EXPECT_EQ(list.size(), 5);
+
+    Timer copy = pool[0];
+    EXPECT_FALSE(copy.byDeadline.is_linked());
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    for (const Timer& timer : pool) {
+        EXPECT_FALSE(timer.byDeadline.is_linked());
+    }
+    EXPECT_THROW(list.pop_front(), std::out_of_range);
+}
+
+TEST_F(IntrusiveListFixture, two_hooks_test) {
+    OwnerList owned;
+    owned.push_back(pool[4]);
+    owned.push_back(pool[1]);
+    list.sort();
+    EXPECT_EQ(ids(list), std::vector<int>({4, 1, 3, 0, 2, 5}));
+    EXPECT_EQ(ids(owned), std::vector<int>({4, 1}));
+
+    owned.reverse();
+    EXPECT_EQ(ids(owned), std::vector<int>({1, 4}));
+    list.erase(pool[4]);
+    EXPECT_EQ(owned.size(), 2);
+    EXPECT_TRUE(pool[4].byOwner.is_linked());
+}
+
+TEST_F(IntrusiveListFixture, splice_sort_test) {
+    TimerList other;
+    other.splice(other.end(), list, list.iterator_to(pool[2]), list.end());
+    EXPECT_EQ(ids(list), std::vector<int>({0, 1}));
+    EXPECT_EQ(ids(other), std::vector<int>({2, 3, 4, 5}));
+    EXPECT_EQ(other.size(), 4);
+
+    list.splice(list.begin(), other, other.iterator_to(pool[4]));
+    list.splice(list.end(), list, list.begin());
+    EXPECT_EQ(ids(list), std::vector<int>({0, 1, 4}));
+
+    list.splice(list.end(), other);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(list.size(), 6);
+
+    list.sort([](const Timer& left, const Timer& right) { return left.deadline > right.deadline; });
+    EXPECT_EQ(ids(list), std::vector<int>({5, 2, 0, 1, 3, 4}));
+    list.reverse();
+    EXPECT_EQ(ids(list), std::vector<int>({4, 3, 1, 0, 2, 5}));
+    std::vector<int> reversed;
+    for (auto it = list.rbegin(); it != list.rend(); ++it) {
+        reversed.push_back(it->id);
+    }
+    EXPECT_EQ(reversed, std::vector<int>({5, 2, 0, 1, 3, 4}));
+
+    TimerList moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(moved.size(), 6);
+    EXPECT_EQ(&moved.front(), &pool[4]);
+    moved.erase(moved.begin(), moved.iterator_to(pool[2]));
+    EXPECT_EQ(ids(moved), std::vector<int>({2, 5}));
+}
+
+TEST_F(IntrusiveListFixture, non_standard_layout_test) {
+    static_assert(!std::is_standard_layout_v<Connection>);
+    std::vector<Connection> connections;
+    for (int fd = 3; fd < 8; ++fd) {
+        connections.emplace_back(fd);
+    }
+    IntrusiveList<Connection, &Connection::byIdle> idle;
+    for (Connection& connection : connections) {
+        idle.push_back(connection);
+    }
+    idle.erase(connections[2]);
+    std::vector<int> fds;
+    for (const Connection& connection : idle) {
+        EXPECT_EQ(connection.kind(), 2);
+        fds.push_back(connection.descriptor());
+    }
+    EXPECT_EQ(fds, std::vector<int>({3, 4, 6, 7}));
+    EXPECT_EQ(&idle.back(), &connections[4]);
+    idle.clear();
+
+#ifndef NDEBUG
+    TimerList other;
+    EXPECT_DEATH(other.erase(pool[0]), "not in this list");
+#endif
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "intrusive_list.hpp"
+#include <vector>
+
+struct Timer {
+    int deadline = 0;
+    int id = 0;
+    ListHook byDeadline;
+    ListHook byOwner;
+
+    Timer(int deadline = 0, int id = 0) : deadline(deadline), id(id) {}
+
+    bool operator<(const Timer& other) const { return deadline < other.deadline; }
+};
+
+/// @brief Базовый класс с данными и виртуальными функциями
+struct Resource {
+    virtual ~Resource() = default;
+    virtual int kind() const { return 1; }
+
+    int refs = 1;
+};
+
+/// @brief Класс без стандартной раскладки: данные в базе, закрытые и открытые члены
+class Connection : public Resource {
+public:
+    explicit Connection(int fd) : fd(fd) {}
+
+    int kind() const override { return 2; }
+    int descriptor() const { return fd; }
+
+    ListHook byIdle;
+
+private:
+    int fd;
+};
+
+using TimerList = IntrusiveList<Timer, &Timer::byDeadline>;
+using OwnerList = IntrusiveList<Timer, &Timer::byOwner>;
+
+class IntrusiveListFixture : public ::testing::Test {
+protected:
+    std::vector<Timer> pool{{5, 0}, {3, 1}, {8, 2}, {3, 3}, {1, 4}, {9, 5}};
+    TimerList list{};
+
+    void SetUp() override {
+        for (Timer& timer : pool) {
+            list.push_back(timer);
+        }
+    }
+
+    template <typename L>
+    static std::vector<int> ids(const L& list) {
+        std::vector<int> result;
+        for (const Timer& timer : list) {
+            result.push_back(timer.id);
+        }
+        return result;
+    }
+};
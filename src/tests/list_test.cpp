@@ -241,4 +241,949 @@ TEST_F(ListFixture, iterators_test) {
     EXPECT_EQ(*it, 3);
     it--;
     EXPECT_EQ(*it, 2);
-}
\ No newline at end of file
+}
+
+TEST_F(ListFixture, pmr_alloc_test) {
+    std::byte buffer[4096];
+    std::pmr::monotonic_buffer_resource pool{buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+    PmrList<int> list{&pool};
+    for (int i = 0; i < 50; ++i) {
+        list.push_back(i);
+    }
+    EXPECT_EQ(list.size(), 50);
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 49);
+    EXPECT_EQ(list.get_allocator().resource(), &pool);
+
+    list.erase(list.begin() + 10, list.end());
+    list.push_front(-1);
+    EXPECT_EQ(list.size(), 11);
+    EXPECT_EQ(list.front(), -1);
+}
+
+TEST_F(ListFixture, pmr_propagation_test) {
+    std::pmr::unsynchronized_pool_resource first_res;
+    std::pmr::unsynchronized_pool_resource second_res;
+
+    PmrList<int> list({1, 2, 3}, &first_res);
+
+    PmrList<int> copy{list};
+    EXPECT_EQ(copy, list);
+    EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+
+    PmrList<int> moved{std::move(copy)};
+    EXPECT_EQ(moved, list);
+    EXPECT_EQ(moved.get_allocator().resource(), std::pmr::get_default_resource());
+
+    PmrList<int> other({4, 5}, &second_res);
+    other = list;
+    EXPECT_EQ(other, list);
+    EXPECT_EQ(other.get_allocator().resource(), &second_res);
+
+    other = PmrList<int>({7, 8, 9, 10}, &first_res);
+    EXPECT_EQ(other, PmrList<int>({7, 8, 9, 10}));
+    EXPECT_EQ(other.get_allocator().resource(), &second_res);
+
+    list.swap(other);
+    EXPECT_EQ(list, PmrList<int>({7, 8, 9, 10}));
+    EXPECT_EQ(other, PmrList<int>({1, 2, 3}));
+    EXPECT_EQ(list.get_allocator().resource(), &first_res);
+    EXPECT_EQ(other.get_allocator().resource(), &second_res);
+
+    list.merge(std::move(other));
+    EXPECT_EQ(list, PmrList<int>({7, 8, 9, 10, 1, 2, 3}));
+    EXPECT_TRUE(other.empty());
+}
+
+TEST_F(ListFixture, sort_relink_test) {
+    List<std::pair<int, int>> list;
+    std::vector<std::pair<int, int>> expected;
+    unsigned seed = 17;
+    for (int i = 0; i < 1000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        list.push_back({static_cast<int>(seed >> 16) % 50, i});
+        expected.push_back({static_cast<int>(seed >> 16) % 50, i});
+    }
+    std::vector<void*> nodes;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        nodes.push_back(it.getNodePtr());
+    }
+
+    auto byKey = [](const std::pair<int, int>& left, const std::pair<int, int>& right) {
+        return left.first < right.first;
+    };
+    list.sort(byKey);
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+
+    size_t i = 0;
+    for (auto it = list.begin(); it != list.end(); ++it, ++i) {
+        EXPECT_EQ(*it, expected[i]);
+        EXPECT_EQ(it.getNodePtr(), nodes[(*it).second]);
+    }
+    EXPECT_EQ(list.back(), expected.back());
+
+    auto it = list.begin() + (list.size() - 1);
+    for (size_t j = list.size() - 1; j > 0; --j) {
+        --it;
+        EXPECT_EQ(*it, expected[j - 1]);
+    }
+
+    List<int> desc = {3, 1, 4, 1, 5, 9, 2, 6};
+    desc.sort(std::greater<int>());
+    EXPECT_EQ(desc, List<int>({9, 6, 5, 4, 3, 2, 1, 1}));
+
+    int calls = 0;
+    auto throwing = [&calls](int left, int right) {
+        if (++calls == 7) {
+            throw std::runtime_error("comparator failed");
+        }
+        return left < right;
+    };
+    EXPECT_THROW(desc.sort(throwing), std::runtime_error);
+    EXPECT_EQ(desc.size(), 8);
+    desc.sort();
+    EXPECT_EQ(desc, List<int>({1, 1, 2, 3, 4, 5, 6, 9}));
+}
+
+TEST_F(ListFixture, move_emplace_test) {
+    List<std::unique_ptr<int>> list;
+    list.push_back(std::make_unique<int>(2));
+    list.push_front(std::make_unique<int>(1));
+    list.emplace_back(new int(4));
+    list.emplace(list.begin() + 2, std::make_unique<int>(3));
+    list.insert(list.begin(), std::make_unique<int>(0));
+    EXPECT_EQ(*list.emplace_front(new int(-1)), -1);
+    EXPECT_EQ(list.size(), 6);
+
+    std::unique_ptr<int> out;
+    for (int expected = -1; expected < 2; ++expected) {
+        list.pop_front(out);
+        EXPECT_EQ(*out, expected);
+    }
+    list.pop_back(out);
+    EXPECT_EQ(*out, 4);
+    EXPECT_EQ(list.size(), 2);
+    EXPECT_THROW(List<std::unique_ptr<int>>().pop_back(out), std::out_of_range);
+
+    List<std::string> strings;
+    std::string& inserted = strings.emplace_back(3, 'a');
+    EXPECT_EQ(inserted, "aaa");
+    auto it = strings.emplace(strings.begin(), "first");
+    EXPECT_EQ(it, strings.begin());
+    EXPECT_EQ(strings.front(), "first");
+}
+
+TEST_F(ListFixture, std_algorithms_test) {
+    using Traits = std::iterator_traits<List<int>::ConstIterator>;
+    static_assert(std::is_same_v<Traits::iterator_category, std::bidirectional_iterator_tag>);
+    static_assert(std::is_same_v<Traits::reference, const int&>);
+    static_assert(std::is_same_v<decltype(*ininList_List.begin()), int&>);
+
+    for (auto& elem : ininList_List) {
+        elem *= 10;
+    }
+    EXPECT_EQ(ininList_List, List<int>({10, 20, 30, 40}));
+
+    const List<int>& const_list = ininList_List;
+    EXPECT_EQ(std::accumulate(const_list.begin(), const_list.end(), 0), 100);
+    EXPECT_EQ(*std::find(const_list.begin(), const_list.end(), 30), 30);
+    EXPECT_EQ(*std::lower_bound(const_list.cbegin(), const_list.cend(), 25), 30);
+    EXPECT_EQ(std::find(const_list.begin(), const_list.end(), 35), const_list.end());
+
+    std::vector<int> reversed(const_list.rbegin(), const_list.rend());
+    EXPECT_EQ(reversed, std::vector<int>({40, 30, 20, 10}));
+
+    auto last = ininList_List.end();
+    --last;
+    EXPECT_EQ(*last, 40);
+    EXPECT_EQ(*(ininList_List.end() - 2), 30);
+    EXPECT_THROW(ininList_List.begin() + 5, std::out_of_range);
+    EXPECT_EQ(ininList_List.begin() + 4, ininList_List.end());
+
+    List<std::string> strings = {"a", "bb"};
+    EXPECT_EQ(strings.begin()->size(), 1);
+    strings.back() += "b";
+    EXPECT_EQ((strings.cend() - 1)->size(), 3);
+}
+
+TEST_F(ListFixture, splice_test) {
+    List<int> list = {1, 2, 3};
+    List<int> other = {4, 5, 6};
+    int* moved_elem = &other.front();
+
+    list.splice(list.begin() + 1, other);
+    EXPECT_EQ(list, List<int>({1, 4, 5, 6, 2, 3}));
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(&*(list.begin() + 1), moved_elem);
+
+    other.splice(other.end(), list, list.begin() + 2);
+    EXPECT_EQ(list, List<int>({1, 4, 6, 2, 3}));
+    EXPECT_EQ(other, List<int>({5}));
+    EXPECT_EQ(list.size(), 5);
+
+    other.splice(other.begin(), list, list.begin() + 1, list.end() - 1);
+    EXPECT_EQ(list, List<int>({1, 3}));
+    EXPECT_EQ(other, List<int>({4, 6, 2, 5}));
+
+    list.splice(list.end(), other, other.begin(), other.begin() + 2, 2);
+    EXPECT_EQ(list, List<int>({1, 3, 4, 6}));
+    EXPECT_EQ(other, List<int>({2, 5}));
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_EQ(other.size(), 2);
+
+    list.splice(list.begin(), list, list.end() - 2, list.end());
+    EXPECT_EQ(list, List<int>({4, 6, 1, 3}));
+    list.splice(list.end(), list, list.begin());
+    EXPECT_EQ(list, List<int>({6, 1, 3, 4}));
+    list.splice(list.begin() + 1, list, list.begin() + 1);
+    EXPECT_EQ(list, List<int>({6, 1, 3, 4}));
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_EQ(*(list.end() - 1), 4);
+
+    list.splice(list.begin(), List<int>{});
+    list.merge(List<int>{});
+    EXPECT_EQ(list, List<int>({6, 1, 3, 4}));
+    list.merge(std::move(other));
+    EXPECT_EQ(list, List<int>({6, 1, 3, 4, 2, 5}));
+    EXPECT_EQ(list.back(), 5);
+    EXPECT_THROW(list.splice(list.begin(), other, other.end()), std::out_of_range);
+
+    std::pmr::unsynchronized_pool_resource first_res;
+    std::pmr::unsynchronized_pool_resource second_res;
+    PmrList<int> pmr_list({1, 2}, &first_res);
+    PmrList<int> pmr_other({3, 4, 5}, &second_res);
+    pmr_list.splice(pmr_list.begin() + 1, pmr_other, pmr_other.begin(), pmr_other.end() - 1);
+    EXPECT_EQ(pmr_list, PmrList<int>({1, 3, 4, 2}));
+    EXPECT_EQ(pmr_other, PmrList<int>({5}));
+}
+
+TEST_F(ListFixture, bulk_insert_erase_test) {
+    List<int> list = {1, 2, 3};
+    std::vector<int> values = {7, 8, 9};
+
+    auto it = list.insert(list.begin() + 1, values.begin(), values.end());
+    EXPECT_EQ(*it, 7);
+    EXPECT_EQ(list, List<int>({1, 7, 8, 9, 2, 3}));
+
+    it = list.insert(list.end(), 2, 0);
+    EXPECT_EQ(it, list.end() - 2);
+    EXPECT_EQ(list, List<int>({1, 7, 8, 9, 2, 3, 0, 0}));
+
+    it = list.insert(list.begin(), std::span<const int>(values.data(), 2));
+    EXPECT_EQ(it, list.begin());
+    EXPECT_EQ(list.size(), 10);
+    EXPECT_EQ(list.front(), 7);
+
+    it = list.insert(list.begin() + 1, values.end(), values.end());
+    EXPECT_EQ(*it, 8);
+    it = list.insert(list.begin(), {-2, -1});
+    EXPECT_EQ(*it, -2);
+    EXPECT_EQ(list, List<int>({-2, -1, 7, 8, 1, 7, 8, 9, 2, 3, 0, 0}));
+
+    it = list.erase(list.begin() + 2, list.begin() + 5);
+    EXPECT_EQ(*it, 7);
+    EXPECT_EQ(list, List<int>({-2, -1, 7, 8, 9, 2, 3, 0, 0}));
+    it = list.erase(list.begin() + 5, list.end());
+    EXPECT_EQ(it, list.end());
+    EXPECT_EQ(list.back(), 9);
+    it = list.erase(list.begin(), list.begin());
+    EXPECT_EQ(it, list.begin());
+    EXPECT_EQ(list.size(), 5);
+    list.erase(list.begin(), list.end());
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+
+    struct Throwing {
+        int value;
+        Throwing(int value) : value(value) {}
+        Throwing(const Throwing& other) : value(other.value) {
+            if (value < 0) {
+                throw std::runtime_error("copy");
+            }
+        }
+    };
+    List<Throwing> throwing;
+    throwing.emplace_back(1);
+    throwing.emplace_back(2);
+    std::vector<Throwing> bad;
+    bad.reserve(3);
+    bad.emplace_back(3);
+    bad.emplace_back(4);
+    bad.emplace_back(-1);
+    EXPECT_THROW(throwing.insert(throwing.begin() + 1, bad.begin(), bad.end()), std::runtime_error);
+    EXPECT_EQ(throwing.size(), 2);
+    EXPECT_EQ(throwing.front().value, 1);
+    EXPECT_EQ(throwing.back().value, 2);
+
+    throwing.clear();
+    EXPECT_TRUE(throwing.empty());
+    throwing.emplace_back(5);
+    EXPECT_EQ(throwing.size(), 1);
+}
+
+TEST_F(ListFixture, parallel_sort_test) {
+    List<std::pair<int, int>> list;
+    std::vector<std::pair<int, int>> expected;
+    unsigned seed = 29;
+    for (int i = 0; i < 10007; ++i) {
+        seed = seed * 1103515245 + 12345;
+        list.push_back({static_cast<int>(seed >> 16) % 100, i});
+        expected.push_back({static_cast<int>(seed >> 16) % 100, i});
+    }
+    std::vector<void*> nodes;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        nodes.push_back(it.getNodePtr());
+    }
+
+    auto byKey = [](const std::pair<int, int>& left, const std::pair<int, int>& right) {
+        return left.first < right.first;
+    };
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+
+    for (size_t threads : {2, 3, 5, 8}) {
+        List<std::pair<int, int>> copy = list;
+        copy.sort(threads, byKey, 64);
+        EXPECT_TRUE(std::equal(copy.begin(), copy.end(), expected.begin(), expected.end()));
+        EXPECT_EQ(copy.back(), expected.back());
+        EXPECT_EQ(*(copy.end() - 2), expected[expected.size() - 2]);
+    }
+
+    list.sort(listPar, byKey);
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        EXPECT_EQ(it.getNodePtr(), nodes[(*it).second]);
+    }
+
+    List<int> small = {3, 1, 2};
+    small.sort(listSeq);
+    EXPECT_EQ(small, List<int>({1, 2, 3}));
+    small.sort(4, std::greater<int>());
+    EXPECT_EQ(small, List<int>({3, 2, 1}));
+
+    List<int> ints;
+    for (int i = 0; i < 1000; ++i) {
+        ints.push_back(1000 - i);
+    }
+    std::atomic<int> calls{0};
+    auto throwing = [&calls](int left, int right) {
+        if (++calls == 3000) {
+            throw std::runtime_error("comparator failed");
+        }
+        return left < right;
+    };
+    EXPECT_THROW(ints.sort(4, throwing, 16), std::runtime_error);
+    EXPECT_EQ(ints.size(), 1000);
+    EXPECT_EQ(std::distance(ints.begin(), ints.end()), 1000);
+    ints.sort(4, std::less<int>(), 16);
+    EXPECT_EQ(ints.front(), 1);
+    EXPECT_EQ(ints.back(), 1000);
+}
+
+/// @brief Ресурс, считающий ещё не освобождённые байты
+struct CountingResource : std::pmr::memory_resource {
+    size_t outstanding = 0;
+
+    void* do_allocate(size_t bytes, size_t align) override {
+        outstanding += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t align) override {
+        outstanding -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+template <typename L>
+bool isContiguous(const L& list) {
+    for (auto it = list.begin(); it != list.end() && std::next(it) != list.end(); ++it) {
+        if (std::next(it).getNodePtr() != it.getNodePtr() + 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_F(ListFixture, compact_test) {
+    CountingResource resource;
+    {
+        PmrList<int> list(&resource);
+        for (int i = 0; i < 1000; ++i) {
+            list.push_back(i);
+            list.push_front(-i);
+        }
+        for (auto it = list.begin(); it != list.end();) {
+            it = list.erase(it);
+            if (it != list.end()) {
+                ++it;
+            }
+        }
+        std::vector<int> expected(list.begin(), list.end());
+        list.compact();
+        EXPECT_TRUE(isContiguous(list));
+        EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+        EXPECT_EQ(*(list.end() - 1), expected.back());
+
+        list.erase(list.begin() + 10, list.begin() + 20);
+        list.push_back(5000);
+        list.sort();
+        list.compact();
+        EXPECT_TRUE(isContiguous(list));
+        EXPECT_EQ(list.size(), expected.size() - 9);
+
+        PmrList<int> other({1, 2, 3}, &resource);
+        other.splice(other.end(), list, list.begin(), list.begin() + 5);
+        EXPECT_EQ(other.size(), 8);
+        other.splice(other.begin(), list);
+        EXPECT_TRUE(list.empty());
+        EXPECT_EQ(other.size(), expected.size() - 6);
+        list.compact();
+        list = std::move(other);
+        EXPECT_EQ(list.size(), expected.size() - 6);
+        list.clear();
+    }
+    EXPECT_EQ(resource.outstanding, 0);
+}
+
+TEST_F(ListFixture, compact_incremental_test) {
+    List<int> list;
+    size_t count = 3 * List<int>::compactChunk + 7;
+    for (size_t i = 0; i < count; ++i) {
+        list.push_front(static_cast<int>(i));
+    }
+    size_t steps = 1;
+    while (!list.compact(std::chrono::nanoseconds(0))) {
+        ++steps;
+        list.erase(list.begin());
+        list.push_back(-1);
+    }
+    EXPECT_EQ(steps, 4);
+    EXPECT_EQ(list.size(), count);
+    EXPECT_EQ(list.back(), -1);
+    EXPECT_EQ(std::distance(list.begin(), list.end()), static_cast<std::ptrdiff_t>(count));
+    EXPECT_EQ(std::distance(list.rbegin(), list.rend()), static_cast<std::ptrdiff_t>(count));
+}
+
+TEST_F(ListFixture, scan_algorithms_test) {
+    for (int size : {0, 1, 7, 8, 9, 100}) {
+        List<int> list;
+        for (int i = 0; i < size; ++i) {
+            list.push_back(i / 3);
+        }
+        std::vector<int> model(list.begin(), list.end());
+
+        int sum = 0;
+        list.for_each([&sum](int value) { sum += value; });
+        EXPECT_EQ(sum, std::accumulate(model.begin(), model.end(), 0));
+        EXPECT_EQ(list.accumulate(0), sum);
+        auto append = [](std::string acc, int value) { return acc + static_cast<char>('a' + value % 26); };
+        EXPECT_EQ(list.accumulate(std::string(), append),
+                  std::accumulate(model.begin(), model.end(), std::string(), append));
+
+        auto odd = [](int value) { return value % 2 != 0; };
+        EXPECT_EQ(list.count_if(odd), static_cast<size_t>(std::count_if(model.begin(), model.end(), odd)));
+        EXPECT_EQ(std::distance(list.begin(), list.find(size / 3 - 1)),
+                  std::distance(model.begin(), std::find(model.begin(), model.end(), size / 3 - 1)));
+        EXPECT_EQ(list.find(-1), list.end());
+        EXPECT_EQ(std::distance(list.cbegin(), std::as_const(list).find_if(odd)),
+                  std::distance(model.begin(), std::find_if(model.begin(), model.end(), odd)));
+
+        EXPECT_EQ(list.unique(), model.size() - (model.empty() ? 0 : model.back() + 1));
+        model.erase(std::unique(model.begin(), model.end()), model.end());
+        EXPECT_TRUE(std::equal(list.begin(), list.end(), model.begin(), model.end()));
+
+        EXPECT_EQ(list.remove_if(odd), static_cast<size_t>(std::count_if(model.begin(), model.end(), odd)));
+        model.erase(std::remove_if(model.begin(), model.end(), odd), model.end());
+        EXPECT_TRUE(std::equal(list.begin(), list.end(), model.begin(), model.end()));
+        EXPECT_EQ(list.size(), model.size());
+        EXPECT_EQ(std::distance(list.rbegin(), list.rend()), static_cast<std::ptrdiff_t>(model.size()));
+    }
+
+    List<std::string> strings = {"a", "bb", "bb", "ccc", "a", "a"};
+    EXPECT_EQ(strings.find("ccc"), strings.begin() + 3);
+    EXPECT_EQ(strings.count_if([](const std::string& value) { return value.size() > 1; }), 3);
+    EXPECT_EQ(strings.unique(), 2);
+    EXPECT_EQ(strings, List<std::string>({"a", "bb", "ccc", "a"}));
+    const std::string& first = strings.front();
+    EXPECT_EQ(strings.remove_if([&first](const std::string& value) { return value == first; }), 2);
+    EXPECT_EQ(strings, List<std::string>({"bb", "ccc"}));
+    strings.for_each([](std::string& value) { value += "!"; });
+    EXPECT_EQ(strings.back(), "ccc!");
+}
+
+TEST_F(ListFixture, save_load_test) {
+    struct Point {
+        int x;
+        double y;
+        bool operator==(const Point&) const = default;
+    };
+    constexpr size_t chunk = List<Point>::ioChunkBytes / sizeof(Point);
+    for (size_t size : {size_t(0), size_t(1), chunk - 1, chunk, 2 * chunk + 3}) {
+        List<Point> points;
+        for (size_t i = 0; i < size; ++i) {
+            points.push_back({static_cast<int>(i), i * 0.5});
+        }
+        std::stringstream stream;
+        points.save(stream);
+        List<Point> loaded{{-1, -1.0}};
+        loaded.load(stream);
+        EXPECT_EQ(loaded, points);
+        EXPECT_EQ(std::distance(loaded.rbegin(), loaded.rend()), static_cast<std::ptrdiff_t>(size));
+        if (size <= chunk) {
+            EXPECT_TRUE(isContiguous(loaded));
+        }
+    }
+
+    CountingResource resource;
+    {
+        PmrList<int> ints(&resource);
+        for (int i = 0; i < 100000; ++i) {
+            ints.push_back(i);
+        }
+        std::stringstream stream;
+        ints.save(stream);
+        PmrList<int> loaded(&resource);
+        loaded.load(stream);
+        EXPECT_EQ(loaded, ints);
+        loaded.erase(loaded.begin() + 10, loaded.end() - 10);
+        loaded.push_front(-1);
+        EXPECT_EQ(loaded.size(), 21);
+    }
+    EXPECT_EQ(resource.outstanding, 0);
+
+    List<std::string> strings = {"", "a", std::string(10000, 'x'), "list"};
+    std::stringstream stream;
+    strings.save(stream);
+    List<std::string> loadedStrings;
+    loadedStrings.load(stream);
+    EXPECT_EQ(loadedStrings, strings);
+
+    std::stringstream ints;
+    ininList_List.save(ints);
+    std::string bytes = ints.str();
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+    List<int> list = {7};
+    EXPECT_THROW(list.load(truncated), std::runtime_error);
+    EXPECT_EQ(list, List<int>({7}));
+    std::stringstream wrongType(bytes);
+    EXPECT_THROW(loadedStrings.load(wrongType), std::runtime_error);
+    EXPECT_EQ(loadedStrings, strings);
+    std::stringstream garbage("not a list at all");
+    EXPECT_THROW(list.load(garbage), std::runtime_error);
+
+    FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    int fd = fileno(file);
+    ininList_List.save(fd);
+    strings.save(fd);
+    ASSERT_EQ(lseek(fd, 0, SEEK_SET), 0);
+    list.load(fd);
+    EXPECT_EQ(list, ininList_List);
+    std::fclose(file);
+    EXPECT_THROW(list.load(-1), std::system_error);
+}
+
+TEST_F(ListFixture, stats_test) {
+    using CountedList = List<int, std::allocator<int>, CountingListStats>;
+    static_assert(sizeof(List<int>) + sizeof(ListStats) == sizeof(CountedList));
+    EXPECT_EQ(ininList_List.stats().allocations, 0);
+
+    ListStats before = globalListStats();
+    CountedList list;
+    for (int i = 5; i > 0; --i) {
+        list.push_back(i);
+    }
+    EXPECT_EQ(list.stats().allocations, 5);
+    EXPECT_GT(list.stats().bytesInUse, 0);
+
+    EXPECT_EQ(*(list.begin() + 3), 2);
+    EXPECT_EQ(*(list.end() - 2), 2);
+    EXPECT_EQ(list.stats().nodesWalked, 5);
+    EXPECT_THROW(list.begin() + 7, std::out_of_range);
+    EXPECT_EQ(list.stats().nodesWalked, 10);
+    EXPECT_THROW(list.end() - 7, std::out_of_range);
+    EXPECT_EQ(list.stats().nodesWalked, 15);
+
+    list.sort();
+    EXPECT_GE(list.stats().comparisons, 4);
+    EXPECT_EQ(list.stats().relinks, 5);
+    list.sort();
+    EXPECT_EQ(list.stats().relinks, 5);
+
+    CountedList other = {10, 11};
+    list.merge(std::move(other));
+    EXPECT_EQ(list.stats().merges, 1);
+    EXPECT_EQ(list.stats().splices, 1);
+    list.clear();
+    EXPECT_EQ(list.stats().deallocations, 7);
+    EXPECT_EQ(list.stats().bytesInUse + other.stats().bytesInUse, 0);
+
+    std::thread worker([] {
+        CountedList local = {3, 1, 2};
+        local.sort();
+    });
+    worker.join();
+    ListStats after = globalListStats();
+    EXPECT_EQ(after.allocations - before.allocations, 10);
+    EXPECT_EQ(after.deallocations - before.deallocations, 10);
+    EXPECT_EQ(after.bytesInUse, before.bytesInUse);
+    EXPECT_EQ(after.merges - before.merges, 1);
+    EXPECT_GT(after.comparisons - before.comparisons, list.stats().comparisons);
+
+    list.reset_stats();
+    EXPECT_EQ(list.stats().comparisons, 0);
+}
+
+TEST_F(ListFixture, bulk_stats_test) {
+    using CountedList = List<int, std::allocator<int>, CountingListStats>;
+    CountedList list;
+    list.insert(list.end(), 5, 7);
+    std::vector<int> values = {1, 2, 3};
+    list.insert(list.begin(), values.begin(), values.end());
+    EXPECT_EQ(list.size(), 8);
+    EXPECT_EQ(list.stats().allocations, 8);
+    EXPECT_EQ(list.stats().splices, 0);
+    list.clear();
+    EXPECT_EQ(list.stats().deallocations, 8);
+    EXPECT_EQ(list.stats().bytesInUse, 0);
+
+    CountedList source = {1, 2, 3, 4};
+    std::stringstream stream;
+    source.save(stream);
+    CountedList loaded = {9, 9};
+    loaded.load(stream);
+    EXPECT_TRUE(loaded == source);
+    // узлы читаются одним блоком, прежние два узла освобождены
+    EXPECT_EQ(loaded.stats().allocations, 3);
+    EXPECT_EQ(loaded.stats().deallocations, 2);
+    loaded.clear();
+    EXPECT_EQ(loaded.stats().deallocations, 3);
+    EXPECT_EQ(loaded.stats().bytesInUse, 0);
+
+    using CountedStrings = List<std::string, std::allocator<std::string>, CountingListStats>;
+    CountedStrings strings = {"a", "b", "c", "d"};
+    std::stringstream stringStream;
+    strings.save(stringStream);
+    CountedStrings loadedStrings;
+    loadedStrings.load(stringStream);
+    EXPECT_EQ(loadedStrings.stats().allocations, 4);
+
+    CountedList copy;
+    copy = source;
+    EXPECT_EQ(copy.stats().allocations, 4);
+}
+
+TEST_F(ListFixture, reserve_reuse_test) {
+    List<int, std::allocator<int>, CountingListStats> queue;
+    queue.reserve(16);
+    EXPECT_EQ(queue.capacity(), 16);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.stats().allocations, 16);
+
+    for (int tick = 0; tick < 100; ++tick) {
+        for (int i = 0; i < 10; ++i) {
+            queue.push_back(tick * 10 + i);
+        }
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_EQ(queue.front(), tick * 10 + i);
+            queue.pop_front();
+        }
+    }
+    EXPECT_EQ(queue.stats().allocations, 16);
+    EXPECT_EQ(queue.stats().deallocations, 0);
+
+    queue.insert(queue.end(), {1, 2, 3});
+    queue.clear(true);
+    EXPECT_EQ(queue.capacity(), 16);
+    queue.emplace_back(7);
+    queue.reserve(4);
+    EXPECT_EQ(queue.capacity(), 16);
+    queue.shrink_to_fit();
+    EXPECT_EQ(queue.capacity(), 1);
+    EXPECT_EQ(queue.stats().deallocations, 15);
+
+    CountingResource resource;
+    {
+        PmrList<int> first({1, 2, 3, 4}, &resource);
+        first.pop_back();
+        first.compact();
+        first.erase(first.begin());
+        PmrList<int> second(&resource);
+        second.splice(second.end(), first);
+        EXPECT_EQ(second, PmrList<int>({2, 3}));
+        second.push_back(5);
+        EXPECT_EQ(second.capacity(), 4);
+        PmrList<int> moved(std::move(second));
+        EXPECT_EQ(moved.capacity(), 4);
+        first = moved;
+        first.clear();
+        EXPECT_EQ(first.capacity(), 0);
+    }
+    EXPECT_EQ(resource.outstanding, 0);
+}
+
+TEST_F(ListFixture, sorted_merge_partition_test) {
+    using Pair = std::pair<int, int>;
+    auto byKey = [](const Pair& left, const Pair& right) { return left.first < right.first; };
+    List<Pair> left = {{1, 0}, {3, 0}, {3, 1}, {7, 0}};
+    List<Pair> right = {{0, 2}, {3, 2}, {8, 2}};
+    const Pair* rightFirst = &right.front();
+    left.merge(right, byKey);
+    EXPECT_TRUE(right.empty());
+    EXPECT_EQ(left, List<Pair>({{0, 2}, {1, 0}, {3, 0}, {3, 1}, {3, 2}, {7, 0}, {8, 2}}));
+    EXPECT_EQ(&left.front(), rightFirst);
+    EXPECT_EQ(std::vector<Pair>(left.rbegin(), left.rend()),
+              std::vector<Pair>({{8, 2}, {7, 0}, {3, 2}, {3, 1}, {3, 0}, {1, 0}, {0, 2}}));
+
+    List<int> desc = {9, 5, 1};
+    desc.merge(List<int>{8, 2}, std::greater<int>());
+    EXPECT_EQ(desc, List<int>({9, 8, 5, 2, 1}));
+    EXPECT_EQ(desc.back(), 1);
+    desc.merge(desc, std::greater<int>());
+    desc.merge(List<int>{}, std::greater<int>());
+    EXPECT_EQ(desc.size(), 5);
+
+    List<int> throwing = {1, 4, 7};
+    int budget = 3;
+    auto limited = [&budget](int a, int b) {
+        if (--budget < 0) {
+            throw std::runtime_error("comparison budget");
+        }
+        return a < b;
+    };
+    EXPECT_THROW(throwing.merge(List<int>{2, 3, 5, 6}, limited), std::runtime_error);
+    EXPECT_EQ(throwing.size(), 7);
+    std::vector<int> forward(throwing.begin(), throwing.end());
+    std::vector<int> backward(throwing.rbegin(), throwing.rend());
+    std::reverse(backward.begin(), backward.end());
+    EXPECT_EQ(forward, backward);
+    std::sort(forward.begin(), forward.end());
+    EXPECT_EQ(forward, std::vector<int>({1, 2, 3, 4, 5, 6, 7}));
+
+    List<int> even = {2, 4, 6};
+    List<int> odd = {1, 3, 5};
+    odd.compact();
+    even.merge(odd, std::less<int>());
+    EXPECT_EQ(even, List<int>({1, 2, 3, 4, 5, 6}));
+    even.clear();
+
+    CountingResource firstResource;
+    CountingResource secondResource;
+    {
+        PmrList<int> first({1, 4, 6}, &firstResource);
+        PmrList<int> second({2, 3, 5}, &secondResource);
+        first.merge(second, std::less<int>());
+        EXPECT_EQ(first, PmrList<int>({1, 2, 3, 4, 5, 6}));
+        EXPECT_TRUE(second.empty());
+    }
+    EXPECT_EQ(firstResource.outstanding, 0);
+    EXPECT_EQ(secondResource.outstanding, 0);
+
+    List<int> values = {1, 2, 1, 3, 1};
+    EXPECT_EQ(values.remove(values.front()), 3);
+    EXPECT_EQ(values, List<int>({2, 3}));
+    EXPECT_EQ(values.remove(7), 0);
+
+    List<int> numbers = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    const int* two = &*(numbers.begin() + 1);
+    List<int> odds = numbers.partition([](int value) { return value % 2 == 0; });
+    EXPECT_EQ(numbers, List<int>({2, 4, 6, 8, 10}));
+    EXPECT_EQ(odds, List<int>({1, 3, 5, 7, 9}));
+    EXPECT_EQ(&numbers.front(), two);
+    EXPECT_EQ(std::vector<int>(odds.rbegin(), odds.rend()), std::vector<int>({9, 7, 5, 3, 1}));
+
+    numbers.compact();
+    List<int> big = numbers.partition([](int value) { return value < 5; });
+    EXPECT_EQ(numbers, List<int>({2, 4}));
+    EXPECT_EQ(big, List<int>({6, 8, 10}));
+    EXPECT_TRUE(List<int>().partition([](int) { return true; }).empty());
+
+    CountingResource resource;
+    {
+        PmrList<int> pmr({1, 2, 3, 4, 5, 6}, &resource);
+        const int* three = &*(pmr.begin() + 2);
+        size_t outstanding = resource.outstanding;
+        PmrList<int> rejected = pmr.partition([](int value) { return value > 3; });
+        EXPECT_EQ(rejected.get_allocator().resource(), &resource);
+        EXPECT_EQ(resource.outstanding, outstanding);
+        EXPECT_EQ(&*(rejected.begin() + 2), three);
+        EXPECT_EQ(pmr, PmrList<int>({4, 5, 6}));
+    }
+    EXPECT_EQ(resource.outstanding, 0);
+
+    List<int> interrupted = {1, 2, 3, 4, 5, 6};
+    EXPECT_THROW(interrupted.partition([](int value) {
+        if (value == 5) {
+            throw std::runtime_error("pred");
+        }
+        return value % 2 == 0;
+    }), std::runtime_error);
+    EXPECT_EQ(interrupted, List<int>({2, 4, 5, 6, 1, 3}));
+}
+
+TEST_F(ListFixture, radix_sort_test) {
+    std::vector<int64_t> numbers;
+    uint64_t seed = 88172645463325252ull;
+    for (int i = 0; i < 5000; ++i) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        numbers.push_back(static_cast<int64_t>(seed) >> (i % 40));
+    }
+    numbers.push_back(std::numeric_limits<int64_t>::min());
+    numbers.push_back(std::numeric_limits<int64_t>::max());
+    List<int64_t> list;
+    list.insert(list.end(), numbers.begin(), numbers.end());
+    list.sort();
+    std::vector<int64_t> expected = numbers;
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(std::vector<int64_t>(list.begin(), list.end()), expected);
+    std::vector<int64_t> backward(list.rbegin(), list.rend());
+    EXPECT_EQ(std::vector<int64_t>(backward.rbegin(), backward.rend()), expected);
+    EXPECT_EQ(list.back(), std::numeric_limits<int64_t>::max());
+
+    list.sort(std::greater<>());
+    std::reverse(expected.begin(), expected.end());
+    EXPECT_EQ(std::vector<int64_t>(list.begin(), list.end()), expected);
+
+    List<uint8_t> bytes;
+    for (int i = 0; i < 300; ++i) {
+        bytes.push_back(static_cast<uint8_t>(i * 37));
+    }
+    bytes.sort();
+    EXPECT_TRUE(std::is_sorted(bytes.begin(), bytes.end()));
+    EXPECT_EQ(bytes.size(), 300);
+
+    // -0.0 и 0.0 равны, поэтому сохраняют исходный порядок, как и при сортировке сравнением
+    std::vector<double> reals;
+    for (int i = 0; i < 200; ++i) {
+        reals.push_back(i % 3 == 0 ? (i % 2 == 0 ? -0.0 : 0.0) : (i - 100) * 0.75);
+    }
+    reals.push_back(-std::numeric_limits<double>::infinity());
+    reals.push_back(std::numeric_limits<double>::infinity());
+    List<double> realList;
+    realList.insert(realList.end(), reals.begin(), reals.end());
+    realList.sort();
+    std::stable_sort(reals.begin(), reals.end());
+    std::vector<double> sortedReals(realList.begin(), realList.end());
+    EXPECT_EQ(sortedReals, reals);
+    for (size_t i = 0; i < reals.size(); ++i) {
+        EXPECT_EQ(std::signbit(sortedReals[i]), std::signbit(reals[i]));
+    }
+
+    using Record = std::pair<uint32_t, int>;
+    List<Record> records;
+    std::vector<Record> recordModel;
+    for (int i = 0; i < 1000; ++i) {
+        Record record{static_cast<uint32_t>((i * 7919) % 97) + 1'700'000'000u, i};
+        records.push_back(record);
+        recordModel.push_back(record);
+    }
+    auto byTime = [](const Record& record) { return record.first; };
+    records.sort_by_key(byTime);
+    std::stable_sort(recordModel.begin(), recordModel.end(),
+                     [](const Record& left, const Record& right) { return left.first < right.first; });
+    EXPECT_EQ(std::vector<Record>(records.begin(), records.end()), recordModel);
+
+    List<std::string> words = {"ccc", "a", "bb", "dd"};
+    words.sort_by_key([](const std::string& word) { return word.size(); });
+    EXPECT_EQ(words, List<std::string>({"a", "bb", "dd", "ccc"}));
+    words.sort_by_key([](const std::string& word) { return word; });
+    EXPECT_EQ(words, List<std::string>({"a", "bb", "ccc", "dd"}));
+
+    List<int> original;
+    for (int i = 0; i < 100; ++i) {
+        original.push_back(100 - i);
+    }
+    List<int> throwing = original;
+    auto failing = [](int value) {
+        if (value == 50) {
+            throw std::runtime_error("bad key");
+        }
+        return value;
+    };
+    EXPECT_THROW(throwing.sort_by_key(failing), std::runtime_error);
+    EXPECT_EQ(throwing, original);
+}
+
+TEST_F(ListFixture, ranges_test) {
+    static_assert(std::ranges::bidirectional_range<List<int>>);
+    static_assert(std::ranges::sized_range<List<int>>);
+    static_assert(std::ranges::common_range<List<int>>);
+    static_assert(std::ranges::bidirectional_range<const List<int>>);
+    static_assert(std::ranges::viewable_range<List<int>&>);
+
+    List<int> numbers;
+    for (int i = 1; i <= 20; ++i) {
+        numbers.push_back(i);
+    }
+    auto pipeline = numbers
+        | std::views::filter([](int value) { return value % 2 == 0; })
+        | std::views::transform([](int value) { return value * 10; })
+        | std::views::reverse
+        | std::views::take(3);
+    EXPECT_EQ(List<int>(from_range, pipeline), List<int>({200, 180, 160}));
+    EXPECT_EQ(numbers.size(), 20);
+
+    List<int, std::allocator<int>, CountingListStats> sized(from_range, numbers | std::views::transform([](int value) {
+        return value * value;
+    }));
+    EXPECT_EQ(sized.size(), 20);
+    EXPECT_EQ(sized.front(), 1);
+    EXPECT_EQ(sized.back(), 400);
+    EXPECT_EQ(sized.stats().allocations, 20);
+    sized.erase(sized.begin() + 5, sized.end());
+    sized.append_range(std::vector<int>{7, 8});
+    EXPECT_EQ(sized.stats().allocations, 20);
+    EXPECT_EQ(std::vector<int>(sized.begin(), sized.end()), std::vector<int>({1, 4, 9, 16, 25, 7, 8}));
+
+    // узлы из диапазона независимы: по одному переходят в другой список без копирования
+    decltype(sized) target;
+    const int* nine = &*(sized.begin() + 2);
+    target.splice(target.end(), sized, sized.begin() + 2);
+    EXPECT_EQ(&target.front(), nine);
+
+    List<int> filtered(from_range, numbers | std::views::filter([](int value) { return value > 17; }));
+    EXPECT_EQ(filtered, List<int>({18, 19, 20}));
+    List<std::string> words(from_range, filtered | std::views::transform([](int value) {
+        return std::to_string(value);
+    }));
+    EXPECT_EQ(words, List<std::string>({"18", "19", "20"}));
+
+    std::istringstream input("5 4 3");
+    List<int> streamed(from_range, std::views::istream<int>(input));
+    EXPECT_EQ(streamed, List<int>({5, 4, 3}));
+
+    auto it = streamed.insert_range(streamed.begin() + 1, numbers | std::views::take(2));
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(streamed, List<int>({5, 1, 2, 4, 3}));
+    it = streamed.insert_range(streamed.end(), std::vector<int>());
+    EXPECT_EQ(it, streamed.end());
+    streamed.append_range(streamed | std::views::reverse);
+    EXPECT_EQ(streamed, List<int>({5, 1, 2, 4, 3, 3, 4, 2, 1, 5}));
+
+    struct Throwing {
+        int value;
+        Throwing(int value) : value(value) {}
+        Throwing(const Throwing& other) : value(other.value) {
+            if (value < 0) {
+                throw std::runtime_error("copy");
+            }
+        }
+    };
+    List<Throwing> throwing;
+    throwing.emplace_back(1);
+    std::vector<Throwing> bad;
+    bad.reserve(3);
+    bad.emplace_back(2);
+    bad.emplace_back(3);
+    bad.emplace_back(-1);
+    EXPECT_THROW(throwing.append_range(bad), std::runtime_error);
+    EXPECT_THROW(throwing.append_range(bad | std::views::filter([](const Throwing&) { return true; })),
+                 std::runtime_error);
+    EXPECT_EQ(throwing.size(), 1);
+    EXPECT_EQ(throwing.back().value, 1);
+}
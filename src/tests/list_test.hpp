@@ -1,5 +1,14 @@
 #include <gtest/gtest.h>
 #include "list.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <sstream>
+#include <string>
 #include <vector>
 
 class ListFixture : public ::testing::Test {
@@ -0,0 +1,95 @@
+#include "mapped_list_test.hpp"
+
+TEST_F(MappedListFixture, push_pop_test) {
+    MappedList<int> list(path);
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.front(), std::out_of_range);
+    EXPECT_THROW(list.pop_back(), std::out_of_range);
+
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+        list.push_front(-i);
+    }
+    EXPECT_EQ(list.size(), 20);
+    EXPECT_EQ(list.front(), -9);
+    EXPECT_EQ(list.back(), 9);
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(list.front(), -8);
+    EXPECT_EQ(*--list.end(), 8);
+
+    auto it = list.insert(std::next(list.begin(), 3), 100);
+    EXPECT_EQ(*std::prev(it), -6);
+    EXPECT_EQ(*list.erase(it), -5);
+    list.erase(list.begin(), std::next(list.begin(), 8));
+    EXPECT_EQ(toVector(list), std::vector<int>({0, 0, 1, 2, 3, 4, 5, 6, 7, 8}));
+    list.reverse();
+    EXPECT_EQ(list.front(), 8);
+    list.sort();
+    EXPECT_EQ(toVector(list), std::vector<int>({0, 0, 1, 2, 3, 4, 5, 6, 7, 8}));
+    EXPECT_EQ(std::vector<int>(list.rbegin(), list.rend()), std::vector<int>({8, 7, 6, 5, 4, 3, 2, 1, 0, 0}));
+}
+
+TEST_F(MappedListFixture, reopen_test) {
+    struct Record {
+        uint64_t id;
+        double value;
+        bool operator==(const Record&) const = default;
+    };
+    std::vector<Record> expected;
+    {
+        MappedList<Record> list(path, 4);
+        auto first = list.begin();
+        list.push_back({0, 0.5});
+        first = list.begin();
+        for (uint64_t i = 1; i < 5000; ++i) {
+            list.push_back({i, i * 0.5});
+        }
+        EXPECT_GE(list.capacity(), 5000);
+        EXPECT_EQ(first->id, 0);
+        list.erase(std::next(list.begin(), 10), std::next(list.begin(), 20));
+        list.emplace_front(Record{7, 7.0});
+        list.flush();
+        expected = toVector(list);
+    }
+    MappedList<Record> reopened(path, 1);
+    EXPECT_EQ(toVector(reopened), expected);
+    // удалённые узлы переиспользуются после переоткрытия
+    size_t capacity = reopened.capacity();
+    for (int i = 0; i < 9; ++i) {
+        reopened.push_back({100, 1.0});
+    }
+    EXPECT_EQ(reopened.capacity(), capacity);
+
+    MappedList<Record> moved(std::move(reopened));
+    EXPECT_EQ(moved.size(), expected.size() + 9);
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+    moved.push_back({1, 1.0});
+    EXPECT_EQ(moved.back().id, 1);
+}
+
+TEST_F(MappedListFixture, self_reference_growth_test) {
+    MappedList<int> list(path, 1);
+    list.push_back(42);
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(list.front());
+    }
+    EXPECT_EQ(list.size(), 101);
+    EXPECT_EQ(list.back(), 42);
+}
+
+TEST_F(MappedListFixture, invalid_file_test) {
+    {
+        MappedList<int> ints(path);
+        ints.push_back(1);
+    }
+    EXPECT_THROW(MappedList<double>{path}, std::runtime_error);
+    {
+        FILE* file = std::fopen(path.c_str(), "wb");
+        std::fputs("not a list file, just some text that is long enough", file);
+        std::fclose(file);
+    }
+    EXPECT_THROW(MappedList<int>{path}, std::runtime_error);
+    EXPECT_THROW(MappedList<int>("/nonexistent-dir/list.bin"), std::system_error);
+}
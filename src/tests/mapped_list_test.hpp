@@ -0,0 +1,23 @@
+#include <gtest/gtest.h>
+#include "mapped_list.hpp"
+#include "test_helpers.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+class MappedListFixture : public ::testing::Test {
+protected:
+    std::string path;
+
+    void SetUp() override {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        path = (std::filesystem::temp_directory_path()
+                / ("mapped_list_" + std::to_string(::getpid()) + "_" + info->name() + ".bin")).string();
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+};
@@ -0,0 +1,177 @@
+#include "rcu_list_test.hpp"
+
+TEST_F(RcuListFixture, single_thread_test) {
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(toVector(list), std::vector<int>());
+    for (int i = 1; i <= 5; ++i) {
+        list.push_back(i);
+        list.push_front(-i);
+    }
+    EXPECT_EQ(list.size(), 10);
+    EXPECT_EQ(toVector(list), std::vector<int>({-5, -4, -3, -2, -1, 1, 2, 3, 4, 5}));
+    EXPECT_TRUE(list.contains(3));
+    EXPECT_FALSE(list.contains(0));
+    EXPECT_EQ(list.find_if([](int value) { return value > 3; }), 4);
+    EXPECT_EQ(list.find_if([](int value) { return value > 5; }), std::nullopt);
+
+    EXPECT_EQ(list.remove_if([](int value) { return value < 0; }), 5);
+    EXPECT_EQ(list.remove(5), 1);
+    EXPECT_EQ(list.remove(5), 0);
+    EXPECT_EQ(toVector(list), std::vector<int>({1, 2, 3, 4}));
+    long sum = 0;
+    list.for_each([&sum](int value) { sum += value; });
+    EXPECT_EQ(sum, 10);
+    list.push_back(7);
+    EXPECT_EQ(toVector(list), std::vector<int>({1, 2, 3, 4, 7}));
+
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(toVector(list), std::vector<int>());
+    list.synchronize();
+    EXPECT_EQ(list.pending_reclaim(), 0);
+
+    RcuList<std::string> strings;
+    strings.emplace_back(3, 'a');
+    strings.emplace_front("b");
+    EXPECT_EQ(strings.find_if([](const std::string& s) { return s.size() == 3; }), "aaa");
+}
+
+TEST_F(RcuListFixture, reader_keeps_removed_node_test) {
+    for (int i = 1; i <= 3; ++i) {
+        list.push_back(i);
+    }
+    {
+        auto view = list.read();
+        auto it = view.begin();
+        ++it;
+        EXPECT_EQ(list.remove(2), 1);
+        EXPECT_EQ(list.remove(3), 1);
+        // вырезанные узлы живы и сохраняют связь дальше по цепочке
+        EXPECT_EQ(list.pending_reclaim(), 2);
+        EXPECT_EQ(*it, 2);
+        ++it;
+        EXPECT_EQ(*it, 3);
+        ++it;
+        EXPECT_EQ(it, view.end());
+    }
+    EXPECT_EQ(toVector(list), std::vector<int>({1}));
+    list.synchronize();
+    EXPECT_EQ(list.pending_reclaim(), 0);
+}
+
+TEST_F(RcuListFixture, synchronize_waits_for_readers_test) {
+    list.push_back(1);
+    list.push_back(2);
+    std::atomic<bool> reading{false};
+    std::atomic<bool> release{false};
+    std::atomic<bool> synchronized{false};
+
+    std::thread reader([&] {
+        auto view = list.read();
+        reading = true;
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(*view.begin(), 1);
+    });
+    while (!reading.load()) {
+        std::this_thread::yield();
+    }
+    list.remove(1);
+    std::thread writer([&] {
+        list.synchronize();
+        synchronized = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(synchronized.load());
+    EXPECT_EQ(list.pending_reclaim(), 1);
+    release = true;
+    reader.join();
+    writer.join();
+    EXPECT_TRUE(synchronized.load());
+    EXPECT_EQ(list.pending_reclaim(), 0);
+}
+
+TEST_F(RcuListFixture, throwing_predicate_test) {
+    for (int i = 1; i <= 4; ++i) {
+        list.push_back(i);
+    }
+    std::atomic<bool> reading{false};
+    std::atomic<bool> release{false};
+    std::atomic<bool> synchronized{false};
+
+    std::thread reader([&] {
+        auto view = list.read();
+        reading = true;
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+        auto it = view.begin();
+        EXPECT_EQ(*it, 1);
+        ++it;
+        EXPECT_EQ(*it, 2);
+    });
+    while (!reading.load()) {
+        std::this_thread::yield();
+    }
+    auto pred = [](int value) {
+        if (value == 3) {
+            throw std::runtime_error("predicate failed");
+        }
+        return true;
+    };
+    EXPECT_THROW(list.remove_if(pred), std::runtime_error);
+    EXPECT_EQ(toVector(list), std::vector<int>({3, 4}));
+    EXPECT_EQ(list.pending_reclaim(), 2);
+
+    // вырезанные до исключения узлы ждут читателя так же, как после обычного удаления
+    std::thread writer([&] {
+        list.synchronize();
+        synchronized = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(synchronized.load());
+    EXPECT_EQ(list.pending_reclaim(), 2);
+    release = true;
+    reader.join();
+    writer.join();
+    EXPECT_TRUE(synchronized.load());
+    EXPECT_EQ(list.pending_reclaim(), 0);
+}
+
+TEST_F(RcuListFixture, readers_writer_stress_test) {
+    // писатель добавляет возрастающие значения в конец и удаляет самое старое,
+    // поэтому любой читатель видит строго возрастающую последовательность
+    for (int i = 0; i < 100; ++i) {
+        list.push_back(i);
+    }
+    std::atomic<bool> done{false};
+    std::atomic<int> violations{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < readersCount; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                int previous = -1;
+                list.for_each([&](int value) {
+                    if (value <= previous) {
+                        ++violations;
+                    }
+                    previous = value;
+                });
+            }
+        });
+    }
+    for (int step = 0; step < writerSteps; ++step) {
+        list.push_back(100 + step);
+        EXPECT_EQ(list.remove(step), 1);
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(violations.load(), 0);
+    EXPECT_EQ(list.size(), 100);
+    list.synchronize();
+    EXPECT_EQ(list.pending_reclaim(), 0);
+    EXPECT_EQ(toVector(list).front(), writerSteps);
+}
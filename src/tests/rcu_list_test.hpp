@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+#include "rcu_list.hpp"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+class RcuListFixture : public ::testing::Test {
+protected:
+    RcuList<int> list{};
+
+    static std::vector<int> toVector(const RcuList<int>& list) {
+        auto view = list.read();
+        return std::vector<int>(view.begin(), view.end());
+    }
+
+    static constexpr int readersCount = 8;
+    static constexpr int writerSteps = 20000;
+};
@@ -0,0 +1,71 @@
+#include "small_list_test.hpp"
+
+TEST_F(SmallListFixture, inline_storage_test) {
+    SmallList<int, 4> list;
+    EXPECT_EQ(list.inline_available(), 4);
+    for (int i = 0; i < 4; ++i) {
+        list.push_back(i);
+    }
+    EXPECT_EQ(inlineCount(list), 4);
+    EXPECT_EQ(list.inline_available(), 0);
+
+    list.push_back(4);
+    list.push_front(-1);
+    EXPECT_EQ(inlineCount(list), 4);
+    EXPECT_EQ(toVector(list), std::vector<int>({-1, 0, 1, 2, 3, 4}));
+
+    list.erase(list.begin() + 1, list.begin() + 3);
+    // удалённые встроенные узлы остаются в запасе списка и берутся следующими вставками
+    EXPECT_EQ(list.capacity(), 6);
+    EXPECT_EQ(list.inline_available(), 0);
+    list.push_back(5);
+    list.push_back(6);
+    EXPECT_EQ(inlineCount(list), 4);
+    list.sort(std::greater<int>());
+    EXPECT_EQ(toVector(list), std::vector<int>({6, 5, 4, 3, 2, -1}));
+    list.clear();
+    EXPECT_EQ(list.inline_available(), 4);
+}
+
+TEST_F(SmallListFixture, copy_move_swap_test) {
+    SmallList<std::string, 2> small = {"a", "b"};
+    SmallList<std::string, 2> big = {"c", "d", "e", "f"};
+
+    SmallList<std::string, 2> copy(big);
+    EXPECT_EQ(copy, big);
+    EXPECT_EQ(inlineCount(copy), 2);
+
+    SmallList<std::string, 2> moved(std::move(copy));
+    EXPECT_EQ(moved, big);
+    EXPECT_EQ(inlineCount(moved), 2);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(copy.inline_available(), 2);
+
+    small.swap(big);
+    EXPECT_EQ(toVector(small), std::vector<std::string>({"c", "d", "e", "f"}));
+    EXPECT_EQ(toVector(big), std::vector<std::string>({"a", "b"}));
+    EXPECT_EQ(inlineCount(small), 2);
+    EXPECT_EQ(inlineCount(big), 2);
+
+    big = small;
+    EXPECT_EQ(big, small);
+    small = std::move(moved);
+    EXPECT_EQ(toVector(small), std::vector<std::string>({"c", "d", "e", "f"}));
+    EXPECT_EQ(inlineCount(small), 2);
+
+    big.splice(big.begin(), small, small.begin());
+    EXPECT_EQ(big.front(), "c");
+    EXPECT_EQ(small.size(), 3);
+    EXPECT_EQ(inlineCount(big), 2);
+
+    SmallList<std::string, 2> mixed = {"x", "y", "zz", "w"};
+    auto rejected = mixed.partition([](const std::string& value) { return value.size() == 1; });
+    EXPECT_EQ(toVector(rejected), std::vector<std::string>({"zz"}));
+    EXPECT_EQ(inlineCount(rejected), 0);
+    EXPECT_EQ(toVector(mixed), std::vector<std::string>({"x", "y", "w"}));
+    EXPECT_EQ(inlineCount(mixed), 2);
+
+    List<std::string, SmallList<std::string, 2>::allocator_type> plain(big);
+    EXPECT_EQ(inlineCount(plain), 0);
+    EXPECT_TRUE(std::equal(plain.begin(), plain.end(), big.begin(), big.end()));
+}
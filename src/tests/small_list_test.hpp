@@ -0,0 +1,20 @@
+#include <gtest/gtest.h>
+#include "small_list.hpp"
+#include "test_helpers.hpp"
+#include <string>
+#include <vector>
+
+class SmallListFixture : public ::testing::Test {
+protected:
+    /// @brief Сколько элементов списка лежит внутри самого объекта
+    template <typename L>
+    static size_t inlineCount(const L& list) {
+        const auto* first = reinterpret_cast<const unsigned char*>(&list);
+        size_t count = 0;
+        for (const auto& value : list) {
+            const auto* p = reinterpret_cast<const unsigned char*>(&value);
+            count += (p >= first && p < first + sizeof(list)) ? 1 : 0;
+        }
+        return count;
+    }
+};
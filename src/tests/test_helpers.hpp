@@ -0,0 +1,10 @@
+#pragma once
+#include <vector>
+
+/// @brief Элементы списка в порядке обхода
+/// @param list Список с ```value_type```, ```begin``` и ```end```
+/// @return Вектор копий элементов
+template <typename L>
+std::vector<typename L::value_type> toVector(const L& list) {
+    return std::vector<typename L::value_type>(list.begin(), list.end());
+}
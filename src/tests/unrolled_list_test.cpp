@@ -0,0 +1,150 @@
+#include "unrolled_list_test.hpp"
+
+TEST_F(UnrolledListFixture, default_capacity_test) {
+    static_assert(UnrolledList<int>::nodeCapacity >= 16);
+    static_assert(UnrolledList<std::string>::nodeCapacity >= 4);
+    EXPECT_TRUE(empty_List.empty());
+    EXPECT_THROW(empty_List.front(), std::out_of_range);
+    EXPECT_THROW(empty_List.pop_back(), std::out_of_range);
+}
+
+TEST_F(UnrolledListFixture, push_pop_test) {
+    for (int i = 0; i < 10; ++i) {
+        empty_List.push_back(i);
+        empty_List.push_front(-i);
+    }
+    EXPECT_EQ(empty_List.size(), 20);
+    EXPECT_EQ(empty_List.front(), -9);
+    EXPECT_EQ(empty_List.back(), 9);
+
+    int out = 0;
+    empty_List.pop_front(out);
+    EXPECT_EQ(out, -9);
+    empty_List.pop_back(out);
+    EXPECT_EQ(out, 9);
+    EXPECT_EQ(empty_List.size(), 18);
+}
+
+TEST_F(UnrolledListFixture, insert_erase_test) {
+    auto it = ininList_List.insert(ininList_List.begin() + 2, 100);
+    EXPECT_EQ(*it, 100);
+    ininList_List.insert(ininList_List.begin(), -1);
+    ininList_List.insert(ininList_List.end(), 10);
+    it = ininList_List.insert(ininList_List.begin() + 5, {50, 51});
+    EXPECT_EQ(*it, 50);
+    EXPECT_EQ(ininList_List.insert(ininList_List.begin() + 1, {}), ininList_List.begin() + 1);
+    EXPECT_EQ(toVector(ininList_List), std::vector<int>({-1, 1, 2, 100, 3, 50, 51, 4, 5, 6, 7, 8, 9, 10}));
+
+    it = ininList_List.erase(ininList_List.begin() + 3);
+    EXPECT_EQ(*it, 3);
+    it = ininList_List.erase(ininList_List.begin() + 4, ininList_List.begin() + 6);
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(toVector(ininList_List), std::vector<int>({-1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    EXPECT_THROW(ininList_List.erase(ininList_List.end()), std::out_of_range);
+}
+
+/// @brief Элемент, копирование которого бросает, когда исчерпан ```budget```
+struct CopyBudget {
+    static inline int budget = -1;
+    int value;
+
+    CopyBudget(int value) : value(value) {}
+    CopyBudget(const CopyBudget& other) : value(other.value) {
+        if (budget == 0) {
+            throw std::runtime_error("copy");
+        }
+        --budget;
+    }
+    CopyBudget(CopyBudget&& other) : CopyBudget(static_cast<const CopyBudget&>(other)) {}
+    CopyBudget& operator=(const CopyBudget&) = default;
+    CopyBudget& operator=(CopyBudget&&) = default;
+};
+
+TEST_F(UnrolledListFixture, throwing_split_test) {
+    UnrolledList<CopyBudget, 4> list;
+    for (int i = 0; i < 4; ++i) {
+        list.emplace_back(i);
+    }
+    // вставка в середину заполненного узла делит его; второй перенос бросает
+    CopyBudget::budget = 1;
+    EXPECT_THROW(list.emplace(list.begin() + 1, 10), std::runtime_error);
+    CopyBudget::budget = -1;
+    EXPECT_EQ(list.size(), 4);
+    std::vector<int> values;
+    for (const auto& item : list) {
+        values.push_back(item.value);
+    }
+    EXPECT_EQ(values, std::vector<int>({0, 1, 2, 3}));
+    list.emplace(list.begin() + 1, 10);
+    EXPECT_EQ(list.size(), 5);
+    EXPECT_EQ((list.begin() + 1)->value, 10);
+}
+
+TEST_F(UnrolledListFixture, random_ops_test) {
+    UnrolledList<int, 5> list;
+    std::list<int> expected;
+    unsigned seed = 7;
+    for (int step = 0; step < 5000; ++step) {
+        seed = seed * 1103515245 + 12345;
+        unsigned op = (seed >> 16) % 6;
+        size_t pos = expected.empty() ? 0 : (seed >> 8) % (expected.size() + 1);
+        if (op < 3 || expected.empty()) {
+            list.insert(list.begin() + pos, step);
+            expected.insert(std::next(expected.begin(), pos), step);
+        }
+        else if (op < 5) {
+            pos = pos % expected.size();
+            auto it = list.erase(list.begin() + pos);
+            auto exp_it = expected.erase(std::next(expected.begin(), pos));
+            EXPECT_EQ(it == list.end(), exp_it == expected.end());
+            if (exp_it != expected.end()) {
+                EXPECT_EQ(*it, *exp_it);
+            }
+        }
+        else {
+            list.pop_front();
+            expected.pop_front();
+        }
+        ASSERT_EQ(list.size(), expected.size());
+    }
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    EXPECT_TRUE(std::equal(list.rbegin(), list.rend(), expected.rbegin(), expected.rend()));
+}
+
+TEST_F(UnrolledListFixture, merge_sort_reverse_test) {
+    UnrolledList<int, 4> other = {3, -2, 0};
+    ininList_List.merge(std::move(other));
+    EXPECT_TRUE(other.empty());
+    ininList_List.merge(UnrolledList<int, 4>{});
+    EXPECT_EQ(ininList_List.size(), 12);
+
+    ininList_List.sort();
+    EXPECT_EQ(toVector(ininList_List), std::vector<int>({-2, 0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9}));
+
+    ininList_List.reverse();
+    EXPECT_EQ(toVector(ininList_List), std::vector<int>({9, 8, 7, 6, 5, 4, 3, 3, 2, 1, 0, -2}));
+    EXPECT_EQ(*(ininList_List.end() - 12), 9);
+    EXPECT_EQ(*(ininList_List.begin() + 11), -2);
+
+    UnrolledList<int, 4> copy = ininList_List;
+    EXPECT_EQ(copy, ininList_List);
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+    copy = ininList_List;
+    copy.swap(empty_List);
+    EXPECT_EQ(empty_List, ininList_List);
+}
+
+TEST_F(UnrolledListFixture, strings_test) {
+    UnrolledList<std::string, 3> list;
+    for (int i = 0; i < 10; ++i) {
+        list.emplace(list.begin() + list.size() / 2, i, 'x');
+    }
+    list.sort([](const std::string& left, const std::string& right) {
+        return left.size() < right.size();
+    });
+    size_t len = 0;
+    for (const auto& str : list) {
+        EXPECT_EQ(str.size(), len++);
+    }
+}
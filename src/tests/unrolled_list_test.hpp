@@ -0,0 +1,12 @@
+#include <gtest/gtest.h>
+#include "unrolled_list.hpp"
+#include "test_helpers.hpp"
+#include <list>
+#include <string>
+#include <vector>
+
+class UnrolledListFixture : public ::testing::Test {
+protected:
+    UnrolledList<int, 4> empty_List{};
+    UnrolledList<int, 4> ininList_List{1, 2, 3, 4, 5, 6, 7, 8, 9};
+};
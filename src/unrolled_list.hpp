@@ -0,0 +1,1222 @@
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @brief Размер кэш-линии, под который подбирается размер узла ```UnrolledList```
+inline constexpr size_t cacheLineSize = 64;
+
+/**
+ * @brief Ёмкость узла ```UnrolledList``` по умолчанию
+ * @details Узел вместе с заголовком (два указателя и счётчик) занимает около
+ *      четырёх кэш-линий, но не меньше 4 элементов
+ * @tparam T Тип хранимых элементов
+ * @return Количество элементов в одном узле
+ */
+template <typename T>
+constexpr size_t unrolledCapacity() {
+    constexpr size_t header = 2 * sizeof(void*) + sizeof(size_t);
+    constexpr size_t fit = (4 * cacheLineSize - header) / sizeof(T);
+    return fit < 4 ? 4 : fit;
+}
+
+/**
+ * @brief Развёрнутый двусвязный список: каждый узел хранит до ```N``` элементов подряд
+ * @details Повторяет открытый интерфейс ```List```, но при обходе читает память
+ *      блоками, а не по одному узлу на элемент. Вставка и удаление делают
+ *      недействительными итераторы на элементы затронутых узлов
+ * @tparam T Тип хранимых элементов
+ * @tparam N Ёмкость узла
+ * @tparam Alloc Аллокатор элементов; для узлов перепривязывается к ```Node```
+ */
+template <typename T, size_t N = unrolledCapacity<T>(), typename Alloc = std::allocator<T>>
+class UnrolledList {
+    static_assert(N >= 2, "UnrolledList node must hold at least two elements");
+
+protected:
+    /// @brief Узел с массивом элементов
+    struct Node {
+        /// @brief Указатель на предыдущий узел
+        Node* prevP = nullptr;
+
+        /// @brief Указатель на следующий узел
+        Node* nextP = nullptr;
+
+        /// @brief Количество занятых ячеек; занятые ячейки идут подряд с начала
+        size_t count = 0;
+
+        /// @brief Память под элементы
+        alignas(T) unsigned char storage[N * sizeof(T)];
+
+        /// @brief Доступ к ячейке
+        /// @param index Номер ячейки
+        /// @return Указатель на ячейку
+        T* item(size_t index) {
+            return std::launder(reinterpret_cast<T*>(storage)) + index;
+        }
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
+    using ValueAllocTraits = std::allocator_traits<Alloc>;
+
+    /// @brief Выделяет пустой узел
+    /// @return Указатель на узел (ещё не связанный со списком)
+    Node* createNode();
+
+    /// @brief Разрушает элементы узла и освобождает его
+    /// @param node Указатель на узел
+    void destroyNode(Node* node);
+
+    /// @brief Встраивает узел в цепочку перед ```next```
+    /// @param next Узел, перед которым встраивается новый; ```nullptr``` - в конец
+    /// @param node Встраиваемый узел
+    void linkBefore(Node* next, Node* node);
+
+    /// @brief Исключает узел из цепочки (без освобождения)
+    /// @param node Исключаемый узел
+    void unlink(Node* node);
+
+    /// @brief Конструирует элемент в ячейке
+    /// @param slot Ячейка
+    /// @param args Аргументы конструктора
+    template <typename... Args>
+    void construct(T* slot, Args&&... args);
+
+    /// @brief Разрушает элемент в ячейке
+    /// @param slot Ячейка
+    void destroy(T* slot);
+
+    /**
+     * @brief Переносит элементы ```[from, src->count)``` узла ```src``` в конец ```dst```
+     * @details Элементы с бросающим перемещением копируются; при исключении созданные
+     *      в ```dst``` элементы разрушаются, и оба узла остаются прежними
+     * @param src Узел-источник
+     * @param from Первая переносимая ячейка
+     * @param dst Узел-приёмник
+     */
+    void moveTail(Node* src, size_t from, Node* dst);
+
+    /**
+     * @brief Делит заполненный узел пополам перед вставкой в позицию ```index```
+     * @param node Узел
+     * @param index Позиция вставки
+     * @return Узел и позиция вставки после деления
+     */
+    std::pair<Node*, size_t> splitFull(Node* node, size_t index);
+
+    /**
+     * @brief Конструирует элемент в новом узле перед ```next```
+     * @param next Узел, перед которым встраивается новый; ```nullptr``` - в конец
+     * @param args Аргументы конструктора элемента
+     * @return Новый узел
+     */
+    template <typename... Args>
+    Node* emplaceNode(Node* next, Args&&... args);
+
+    /// @brief Обмен узлами с другим списком (аллокаторы не трогаются)
+    /// @param other Список для обмена
+    void swapThis(UnrolledList& other);
+
+    /// @brief Забирает узлы ```other``` в конец списка
+    /// @details Если аллокаторы не равны, элементы перемещаются поштучно
+    /// @param other Список, узлы которого забираются
+    void takeNodes(UnrolledList& other);
+
+    /// @brief Аллокатор узлов
+    NodeAlloc _alloc;
+
+    /// @brief Указатель на первый узел
+    Node* head = nullptr;
+
+    /// @brief Указатель на последний узел
+    Node* tail = nullptr;
+
+    /// @brief Количество элементов списка
+    size_t _size = 0;
+
+public:
+    using value_type = T;
+    using allocator_type = Alloc;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Ёмкость одного узла
+    static constexpr size_t nodeCapacity = N;
+
+    /// @brief Создаёт пустой список
+    UnrolledList();
+
+    /// @brief Создаёт пустой список с заданным аллокатором
+    /// @param alloc Аллокатор
+    explicit UnrolledList(const Alloc& alloc);
+
+    /**
+     * @brief Заполненяет список ```count``` элементами значения ```alloc_elem```
+     * @param count Количество элементов
+     * @param alloc_elem Элемент для заполнения списка
+     * @param alloc Аллокатор
+     */
+    UnrolledList(size_t count, const T& alloc_elem, const Alloc& alloc = Alloc());
+
+    /**
+     * @brief Заполненяет список значениями из ```std::initializer_list<T>```
+     * @param initList Список инициализации
+     * @param alloc Аллокатор
+     */
+    UnrolledList(std::initializer_list<T> initList, const Alloc& alloc = Alloc());
+
+    /// @brief Деструктор
+    ~UnrolledList();
+
+    /// @brief Конструктор копирования
+    /// @param other Копируемый список
+    UnrolledList(const UnrolledList& other);
+
+    /// @brief Конструктор копирования с заданным аллокатором
+    /// @param other Копируемый список
+    /// @param alloc Аллокатор нового списка
+    UnrolledList(const UnrolledList& other, const Alloc& alloc);
+
+    /// @brief Конструктор перемещения
+    /// @param other Перемещаемый список
+    UnrolledList(UnrolledList&& other) noexcept;
+
+    /// @brief Конструктор перемещения с заданным аллокатором
+    /// @param other Перемещаемый список
+    /// @param alloc Аллокатор нового списка
+    UnrolledList(UnrolledList&& other, const Alloc& alloc);
+
+    /// @brief Оператор копирующего присваивания
+    /// @param other Копируемый список
+    /// @return Ссылка на текущий список
+    UnrolledList& operator=(const UnrolledList& other);
+
+    /// @brief Оператор перемещающего присваивания
+    /// @param other Перемещаемый список
+    /// @return Ссылка на текущий список
+    UnrolledList& operator=(UnrolledList&& other) noexcept(
+        NodeAllocTraits::propagate_on_container_move_assignment::value ||
+        NodeAllocTraits::is_always_equal::value);
+
+    /// @brief Инициализация списка через ```std::initializer_list<T>```
+    /// @param initList Список инициализации
+    /// @return Ссылка на текущий список
+    UnrolledList& operator=(std::initializer_list<T> initList);
+
+    /// @brief Обмен содержимым с другим списком
+    /// @param other Список для обмена
+    void swap(UnrolledList& other);
+
+    /// @brief Возвращает копию аллокатора списка
+    /// @return Аллокатор элементов
+    Alloc get_allocator() const;
+
+    /**
+     * @brief Двунаправленный итератор: узел и номер ячейки в нём
+     * @tparam IsConst ```true``` для итератора на константные элементы
+     */
+    template <bool IsConst>
+    struct BasicIterator {
+        friend class UnrolledList;
+        template <bool> friend struct BasicIterator;
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        /// @brief Создаёт итератор, не связанный ни с одним списком
+        BasicIterator() = default;
+
+        /// @brief Конструирование на основе позиции
+        /// @param node Узел
+        /// @param index Номер ячейки
+        /// @param owner Список, которому принадлежит узел
+        BasicIterator(Node* node, size_t index, const UnrolledList* owner)
+            : node(node), index(index), owner(owner) {}
+
+        /// @brief Преобразование итератора в константный
+        /// @param other Неконстантный итератор
+        template <bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        BasicIterator(const BasicIterator<OtherConst>& other)
+            : node(other.node), index(other.index), owner(other.owner) {}
+
+        /// @brief Сдвиг на ```shift``` элементов вперёд; внутри узла за O(1)
+        /// @param shift Величина сдвига
+        /// @return Сдвинутый итератор
+        /// @exception При попытке выйти за пределы списка
+        BasicIterator operator+(size_t shift) const;
+
+        /// @brief Сдвиг на ```shift``` элементов назад
+        /// @param shift Величина сдвига
+        /// @return Сдвинутый итератор
+        /// @exception При попытке выйти за пределы списка
+        BasicIterator operator-(size_t shift) const;
+
+        /// @brief Пре-инкремент
+        /// @return Итератор на следующий элемент
+        BasicIterator& operator++();
+
+        /// @brief Пост-инкремент
+        /// @return Итератор до сдвига
+        BasicIterator operator++(int);
+
+        /// @brief Пре-декремент
+        /// @return Итератор на предыдущий элемент
+        BasicIterator& operator--();
+
+        /// @brief Пост-декремент
+        /// @return Итератор до сдвига
+        BasicIterator operator--(int);
+
+        /// @brief Сравнение позиций двух итераторов
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator==(const BasicIterator<OtherConst>& other) const;
+
+        /// @brief Проверка позиций двух итераторов на неравенство
+        /// @param other Сравниваемый итератор
+        /// @return Результат сравнения
+        template <bool OtherConst>
+        bool operator!=(const BasicIterator<OtherConst>& other) const;
+
+        /// @brief Доступ к элементу
+        /// @return Ссылка на элемент
+        reference operator*() const;
+
+        /// @brief Доступ к членам элемента
+        /// @return Указатель на элемент
+        pointer operator->() const;
+
+    protected:
+        /// @brief Текущий узел; ```nullptr``` для ```end()```
+        Node* node = nullptr;
+
+        /// @brief Номер ячейки в узле
+        size_t index = 0;
+
+        /// @brief Список, из которого получен итератор
+        const UnrolledList* owner = nullptr;
+    };
+
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+    using iterator = Iterator;
+    using const_iterator = ConstIterator;
+    using reverse_iterator = std::reverse_iterator<Iterator>;
+    using const_reverse_iterator = std::reverse_iterator<ConstIterator>;
+
+    /// @brief Поэлементное сравнение двух списков
+    /// @param other Сравниваемый список
+    /// @return Результат сравнения
+    bool operator==(const UnrolledList& other) const;
+
+    /// @brief Поэлементная проверка на неравенство двух списков
+    /// @param other Сравниваемый список
+    /// @return Результат сравнения
+    bool operator!=(const UnrolledList& other) const;
+
+    /// @brief Доступ к первому элементу списка
+    /// @return Первый элемент
+    T& front();
+
+    /// @brief Доступ к первому элементу константного списка
+    /// @return Первый элемент
+    const T& front() const;
+
+    /// @brief Доступ к последнему элементу списка
+    /// @return Последний элемент
+    T& back();
+
+    /// @brief Доступ к последнему элементу константного списка
+    /// @return Последний элемент
+    const T& back() const;
+
+    /// @brief Добавление в начало списка
+    /// @param data Добавляемые данные
+    void push_front(const T& data);
+
+    /// @brief Добавление в начало списка перемещением
+    /// @param data Перемещаемые данные
+    void push_front(T&& data);
+
+    /// @brief Добавление в конец списка
+    /// @param data Добавляемые данные
+    void push_back(const T& data);
+
+    /// @brief Добавление в конец списка перемещением
+    /// @param data Перемещаемые данные
+    void push_back(T&& data);
+
+    /// @brief Конструирует элемент в начале списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_front(Args&&... args);
+
+    /// @brief Конструирует элемент в конце списка
+    /// @param args Аргументы конструктора элемента
+    /// @return Ссылка на созданный элемент
+    template <typename... Args>
+    T& emplace_back(Args&&... args);
+
+    /// @brief Удаление из начала списка
+    void pop_front();
+
+    /// @brief Удаление из начала списка с перемещением элемента в ```out```
+    /// @param out Куда перемещается удаляемый элемент
+    void pop_front(T& out);
+
+    /// @brief Удаление из конца списка
+    void pop_back();
+
+    /// @brief Удаление из конца списка с перемещением элемента в ```out```
+    /// @param out Куда перемещается удаляемый элемент
+    void pop_back(T& out);
+
+    /// @brief Вставка элемента в позицию
+    /// @param pos Позиция для вставки
+    /// @param value Вставляемое значение
+    /// @return Итератор на вставленный элемент
+    Iterator insert(ConstIterator pos, const T& value);
+
+    /// @brief Вставка элемента в позицию перемещением
+    /// @param pos Позиция для вставки
+    /// @param value Перемещаемое значение
+    /// @return Итератор на вставленный элемент
+    Iterator insert(ConstIterator pos, T&& value);
+
+    /// @brief Вставка нескольких элементов в позицию
+    /// @param pos Позиция для вставки
+    /// @param initList Вставляемые значения
+    /// @return Итератор на первый вставленный элемент или ```pos```, если вставлять нечего
+    Iterator insert(ConstIterator pos, std::initializer_list<T> initList);
+
+    /// @brief Конструирует элемент перед ```pos```
+    /// @param pos Позиция для вставки
+    /// @param args Аргументы конструктора элемента
+    /// @return Итератор на созданный элемент
+    template <typename... Args>
+    Iterator emplace(ConstIterator pos, Args&&... args);
+
+    /// @brief Удаление элемента в позиции
+    /// @details Почти пустой узел сливается со следующим
+    /// @param pos Позиция удаляемого элемента
+    /// @return Итератор на следующий элемент
+    Iterator erase(ConstIterator pos);
+
+    /// @brief Удаление элементов в диапазоне [```first```, ```last```)
+    /// @param first Первый удаляемый элемент
+    /// @param last Элемент, до которого идёт удаление
+    /// @return Итератор на элемент last
+    Iterator erase(ConstIterator first, ConstIterator last);
+
+    /// @brief Соединение списков копированием
+    /// @param other Добавляемый в конец список
+    void merge(const UnrolledList& other);
+
+    /// @brief Соединение списков перемещением; при равных аллокаторах за O(1)
+    /// @param other Добавляемый в конец список
+    void merge(UnrolledList&& other);
+
+    /// @brief Устойчиво сортирует элементы списка
+    void sort();
+
+    /// @brief Устойчиво сортирует элементы списка с помощью компаратора
+    /// @details Элементы перемещаются во временный массив и обратно в те же узлы
+    /// @param comp Компаратор: ```true```, если первый элемент строго меньше второго
+    template <typename Compare>
+    void sort(Compare comp);
+
+    /// @brief Оборачивание списка (элементы в обратном порядке)
+    void reverse();
+
+    /// @brief Удаляет все элементы списка
+    void clear();
+
+    /// @brief Проверка на наличие элементов в списке
+    /// @return ```true```, если список пустой, иначе ```false```
+    bool empty() const;
+
+    /// @brief Возвращает размер списка
+    /// @return Количество элементов списка
+    size_t size() const;
+
+    /// @brief Итератор на первый элемент
+    Iterator begin();
+    /// @brief Константный итератор на первый элемент
+    ConstIterator begin() const;
+    /// @brief Итератор за последним элементом
+    Iterator end();
+    /// @brief Константный итератор за последним элементом
+    ConstIterator end() const;
+    /// @brief Константный итератор на первый элемент
+    ConstIterator cbegin() const;
+    /// @brief Константный итератор за последним элементом
+    ConstIterator cend() const;
+    /// @brief Обратный итератор на последний элемент
+    reverse_iterator rbegin();
+    /// @brief Константный обратный итератор на последний элемент
+    const_reverse_iterator rbegin() const;
+    /// @brief Обратный итератор перед первым элементом
+    reverse_iterator rend();
+    /// @brief Константный обратный итератор перед первым элементом
+    const_reverse_iterator rend() const;
+};
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>::UnrolledList() : UnrolledList(Alloc()) {}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>::UnrolledList(const Alloc& alloc) : _alloc(alloc) {}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>::UnrolledList(size_t count, const T& alloc_elem, const Alloc& alloc)
+    : UnrolledList(alloc) {
+    for (size_t i = 0; i < count; ++i) {
+        push_back(alloc_elem);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>::UnrolledList(std::initializer_list<T> initList, const Alloc& alloc)
+    : UnrolledList(alloc) {
+    for (const T& elem : initList) {
+        push_back(elem);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>::~UnrolledList() {
+    clear();
+}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>::UnrolledList(const UnrolledList& other)
+    : UnrolledList(other, ValueAllocTraits::select_on_container_copy_construction(other.get_allocator())) {}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>::UnrolledList(const UnrolledList& other, const Alloc& alloc)
+    : UnrolledList(alloc) {
+    for (const T& elem : other) {
+        push_back(elem);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>::UnrolledList(UnrolledList&& other) noexcept
+    : _alloc(std::move(other._alloc)), head(other.head), tail(other.tail), _size(other._size) {
+    other.head = other.tail = nullptr;
+    other._size = 0;
+}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>::UnrolledList(UnrolledList&& other, const Alloc& alloc)
+    : UnrolledList(alloc) {
+    takeNodes(other);
+}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>& UnrolledList<T, N, Alloc>::operator=(const UnrolledList& other) {
+    if (this != &other) {
+        if constexpr (NodeAllocTraits::propagate_on_container_copy_assignment::value) {
+            if (_alloc != other._alloc) {
+                clear();
+            }
+            _alloc = other._alloc;
+        }
+        UnrolledList tmp(other, get_allocator());
+        swapThis(tmp);
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>& UnrolledList<T, N, Alloc>::operator=(UnrolledList&& other) noexcept(
+    NodeAllocTraits::propagate_on_container_move_assignment::value ||
+    NodeAllocTraits::is_always_equal::value) {
+    if (this != &other) {
+        clear();
+        if constexpr (NodeAllocTraits::propagate_on_container_move_assignment::value) {
+            _alloc = std::move(other._alloc);
+        }
+        takeNodes(other);
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Alloc>
+UnrolledList<T, N, Alloc>& UnrolledList<T, N, Alloc>::operator=(std::initializer_list<T> initList) {
+    *this = UnrolledList(initList, get_allocator());
+    return *this;
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::swap(UnrolledList& other) {
+    if (this == &other) {
+        return;
+    }
+    if constexpr (NodeAllocTraits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(_alloc, other._alloc);
+    }
+    else if (_alloc != other._alloc) {
+        UnrolledList tmp(std::move(*this), get_allocator());
+        *this = std::move(other);
+        other = std::move(tmp);
+        return;
+    }
+    swapThis(other);
+}
+
+template <typename T, size_t N, typename Alloc>
+Alloc UnrolledList<T, N, Alloc>::get_allocator() const {
+    return Alloc(_alloc);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::swapThis(UnrolledList& other) {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(_size, other._size);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::takeNodes(UnrolledList& other) {
+    if (other.empty()) {
+        return;
+    }
+    if (_alloc == other._alloc) {
+        if (empty()) {
+            head = other.head;
+        }
+        else {
+            tail->nextP = other.head;
+            other.head->prevP = tail;
+        }
+        tail = other.tail;
+        _size += other._size;
+        other.head = other.tail = nullptr;
+        other._size = 0;
+    }
+    else {
+        for (T& elem : other) {
+            emplace_back(std::move(elem));
+        }
+        other.clear();
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::Node* UnrolledList<T, N, Alloc>::createNode() {
+    Node* node = NodeAllocTraits::allocate(_alloc, 1);
+    ::new (static_cast<void*>(node)) Node();
+    return node;
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::destroyNode(Node* node) {
+    for (size_t i = 0; i < node->count; ++i) {
+        destroy(node->item(i));
+    }
+    node->~Node();
+    NodeAllocTraits::deallocate(_alloc, node, 1);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::linkBefore(Node* next, Node* node) {
+    Node* prev = next != nullptr ? next->prevP : tail;
+    node->prevP = prev;
+    node->nextP = next;
+    if (prev != nullptr) {
+        prev->nextP = node;
+    }
+    else {
+        head = node;
+    }
+    if (next != nullptr) {
+        next->prevP = node;
+    }
+    else {
+        tail = node;
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::unlink(Node* node) {
+    if (node->prevP != nullptr) {
+        node->prevP->nextP = node->nextP;
+    }
+    else {
+        head = node->nextP;
+    }
+    if (node->nextP != nullptr) {
+        node->nextP->prevP = node->prevP;
+    }
+    else {
+        tail = node->prevP;
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename... Args>
+void UnrolledList<T, N, Alloc>::construct(T* slot, Args&&... args) {
+    Alloc valueAlloc(_alloc);
+    ValueAllocTraits::construct(valueAlloc, slot, std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::destroy(T* slot) {
+    Alloc valueAlloc(_alloc);
+    ValueAllocTraits::destroy(valueAlloc, slot);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::moveTail(Node* src, size_t from, Node* dst) {
+    size_t built = dst->count;
+    try {
+        for (size_t i = from; i < src->count; ++i) {
+            construct(dst->item(dst->count), std::move_if_noexcept(*src->item(i)));
+            ++dst->count;
+        }
+    }
+    catch (...) {
+        while (dst->count > built) {
+            destroy(dst->item(--dst->count));
+        }
+        throw;
+    }
+    for (size_t i = from; i < src->count; ++i) {
+        destroy(src->item(i));
+    }
+    src->count = from;
+}
+
+template <typename T, size_t N, typename Alloc>
+std::pair<typename UnrolledList<T, N, Alloc>::Node*, size_t>
+UnrolledList<T, N, Alloc>::splitFull(Node* node, size_t index) {
+    Node* right = createNode();
+    linkBefore(node->nextP, right);
+    try {
+        moveTail(node, N / 2, right);
+    }
+    catch (...) {
+        unlink(right);
+        destroyNode(right);
+        throw;
+    }
+    if (index > node->count) {
+        return {right, index - node->count};
+    }
+    return {node, index};
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename... Args>
+typename UnrolledList<T, N, Alloc>::Node* UnrolledList<T, N, Alloc>::emplaceNode(Node* next, Args&&... args) {
+    Node* node = createNode();
+    try {
+        construct(node->item(0), std::forward<Args>(args)...);
+    }
+    catch (...) {
+        destroyNode(node);
+        throw;
+    }
+    node->count = 1;
+    linkBefore(next, node);
+    ++_size;
+    return node;
+}
+
+template <typename T, size_t N, typename Alloc>
+bool UnrolledList<T, N, Alloc>::operator==(const UnrolledList& other) const {
+    return _size == other._size && std::equal(begin(), end(), other.begin());
+}
+
+template <typename T, size_t N, typename Alloc>
+bool UnrolledList<T, N, Alloc>::operator!=(const UnrolledList& other) const {
+    return !(*this == other);
+}
+
+template <typename T, size_t N, typename Alloc>
+T& UnrolledList<T, N, Alloc>::front() {
+    if (!head) {
+        throw std::out_of_range("List is empty!");
+    }
+    return *head->item(0);
+}
+
+template <typename T, size_t N, typename Alloc>
+const T& UnrolledList<T, N, Alloc>::front() const {
+    if (!head) {
+        throw std::out_of_range("List is empty!");
+    }
+    return *head->item(0);
+}
+
+template <typename T, size_t N, typename Alloc>
+T& UnrolledList<T, N, Alloc>::back() {
+    if (!tail) {
+        throw std::out_of_range("List is empty!");
+    }
+    return *tail->item(tail->count - 1);
+}
+
+template <typename T, size_t N, typename Alloc>
+const T& UnrolledList<T, N, Alloc>::back() const {
+    if (!tail) {
+        throw std::out_of_range("List is empty!");
+    }
+    return *tail->item(tail->count - 1);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::push_front(T&& data) {
+    emplace_front(std::move(data));
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename... Args>
+T& UnrolledList<T, N, Alloc>::emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename... Args>
+T& UnrolledList<T, N, Alloc>::emplace_back(Args&&... args) {
+    if (tail == nullptr || tail->count == N) {
+        emplaceNode(nullptr, std::forward<Args>(args)...);
+    }
+    else {
+        construct(tail->item(tail->count), std::forward<Args>(args)...);
+        ++tail->count;
+        ++_size;
+    }
+    return *tail->item(tail->count - 1);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(begin());
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::pop_front(T& out) {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    out = std::move(front());
+    erase(begin());
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    erase(Iterator(tail, tail->count - 1, this));
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::pop_back(T& out) {
+    if (empty()) {
+        throw std::out_of_range("List is empty!");
+    }
+    out = std::move(back());
+    erase(Iterator(tail, tail->count - 1, this));
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::Iterator
+UnrolledList<T, N, Alloc>::insert(ConstIterator pos, const T& value) {
+    return emplace(pos, value);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::Iterator
+UnrolledList<T, N, Alloc>::insert(ConstIterator pos, T&& value) {
+    return emplace(pos, std::move(value));
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::Iterator
+UnrolledList<T, N, Alloc>::insert(ConstIterator pos, std::initializer_list<T> initList) {
+    if (initList.size() == 0) {
+        return Iterator(pos.node, pos.index, this);
+    }
+    Iterator it = insert(pos, *initList.begin());
+    for (auto value = initList.begin() + 1; value != initList.end(); ++value) {
+        it = insert(++it, *value);
+    }
+    // вставки могли разделить узлы, поэтому итератор на первый элемент получаем в конце
+    for (size_t i = 1; i < initList.size(); ++i) {
+        --it;
+    }
+    return it;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename... Args>
+typename UnrolledList<T, N, Alloc>::Iterator
+UnrolledList<T, N, Alloc>::emplace(ConstIterator pos, Args&&... args) {
+    if (pos.node == nullptr) {
+        emplace_back(std::forward<Args>(args)...);
+        return Iterator(tail, tail->count - 1, this);
+    }
+    Node* node = pos.node;
+    size_t index = pos.index;
+    if (index == 0 && node->count == N) {
+        // вставка в начало заполненного узла: дописываем в конец предыдущего
+        Node* prev = node->prevP;
+        if (prev == nullptr || prev->count == N) {
+            return Iterator(emplaceNode(node, std::forward<Args>(args)...), 0, this);
+        }
+        node = prev;
+        index = prev->count;
+    }
+    if (index == node->count) {
+        construct(node->item(index), std::forward<Args>(args)...);
+        ++node->count;
+        ++_size;
+        return Iterator(node, index, this);
+    }
+
+    T value(std::forward<Args>(args)...);
+    if (node->count == N) {
+        std::tie(node, index) = splitFull(node, index);
+        if (index == node->count) {
+            construct(node->item(index), std::move(value));
+            ++node->count;
+            ++_size;
+            return Iterator(node, index, this);
+        }
+    }
+    construct(node->item(node->count), std::move(*node->item(node->count - 1)));
+    ++node->count;
+    std::move_backward(node->item(index), node->item(node->count - 2), node->item(node->count - 1));
+    *node->item(index) = std::move(value);
+    ++_size;
+    return Iterator(node, index, this);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::Iterator UnrolledList<T, N, Alloc>::erase(ConstIterator pos) {
+    if (empty()) {
+        throw std::out_of_range("Trying to erase in empty list!");
+    }
+    if (pos.node == nullptr) {
+        throw std::out_of_range("Invalid erasing");
+    }
+    Node* node = pos.node;
+    size_t index = pos.index;
+
+    std::move(node->item(index + 1), node->item(node->count), node->item(index));
+    destroy(node->item(node->count - 1));
+    --node->count;
+    --_size;
+
+    if (node->count == 0) {
+        Node* next = node->nextP;
+        unlink(node);
+        destroyNode(node);
+        return Iterator(next, 0, this);
+    }
+    Node* next = node->nextP;
+    if (next != nullptr && node->count < N / 2 && node->count + next->count <= N) {
+        moveTail(next, 0, node);
+        unlink(next);
+        destroyNode(next);
+    }
+    if (index < node->count) {
+        return Iterator(node, index, this);
+    }
+    return Iterator(node->nextP, 0, this);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::Iterator
+UnrolledList<T, N, Alloc>::erase(ConstIterator first, ConstIterator last) {
+    if (empty()) {
+        throw std::out_of_range("Trying to erase in empty list!");
+    }
+    // слияние узлов при удалении сдвигает позиции, поэтому считаем количество заранее
+    size_t count = std::distance(first, last);
+    Iterator it(first.node, first.index, this);
+    for (size_t i = 0; i < count; ++i) {
+        it = erase(it);
+    }
+    return it;
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::merge(const UnrolledList& other) {
+    if (this != &other) {
+        UnrolledList tmp(other, get_allocator());
+        merge(std::move(tmp));
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::merge(UnrolledList&& other) {
+    if (this != &other) {
+        takeNodes(other);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::sort() {
+    sort(std::less<T>());
+}
+
+template <typename T, size_t N, typename Alloc>
+template <typename Compare>
+void UnrolledList<T, N, Alloc>::sort(Compare comp) {
+    if (_size < 2) {
+        return;
+    }
+    Alloc valueAlloc(_alloc);
+    std::vector<T, Alloc> values(valueAlloc);
+    values.reserve(_size);
+    for (T& elem : *this) {
+        values.push_back(std::move(elem));
+    }
+    std::stable_sort(values.begin(), values.end(), comp);
+    auto value = values.begin();
+    for (T& elem : *this) {
+        elem = std::move(*value++);
+    }
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::reverse() {
+    Node* current = head;
+    while (current != nullptr) {
+        std::reverse(current->item(0), current->item(current->count));
+        std::swap(current->nextP, current->prevP);
+        current = current->prevP;
+    }
+    std::swap(head, tail);
+}
+
+template <typename T, size_t N, typename Alloc>
+void UnrolledList<T, N, Alloc>::clear() {
+    Node* current = head;
+    while (current != nullptr) {
+        Node* next = current->nextP;
+        destroyNode(current);
+        current = next;
+    }
+    head = tail = nullptr;
+    _size = 0;
+}
+
+template <typename T, size_t N, typename Alloc>
+bool UnrolledList<T, N, Alloc>::empty() const {
+    return _size == 0;
+}
+
+template <typename T, size_t N, typename Alloc>
+size_t UnrolledList<T, N, Alloc>::size() const {
+    return _size;
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::Iterator UnrolledList<T, N, Alloc>::begin() {
+    return Iterator(head, 0, this);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::ConstIterator UnrolledList<T, N, Alloc>::begin() const {
+    return ConstIterator(head, 0, this);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::Iterator UnrolledList<T, N, Alloc>::end() {
+    return Iterator(nullptr, 0, this);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::ConstIterator UnrolledList<T, N, Alloc>::end() const {
+    return ConstIterator(nullptr, 0, this);
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::ConstIterator UnrolledList<T, N, Alloc>::cbegin() const {
+    return begin();
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::ConstIterator UnrolledList<T, N, Alloc>::cend() const {
+    return end();
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::reverse_iterator UnrolledList<T, N, Alloc>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::const_reverse_iterator UnrolledList<T, N, Alloc>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::reverse_iterator UnrolledList<T, N, Alloc>::rend() {
+    return reverse_iterator(begin());
+}
+
+template <typename T, size_t N, typename Alloc>
+typename UnrolledList<T, N, Alloc>::const_reverse_iterator UnrolledList<T, N, Alloc>::rend() const {
+    return const_reverse_iterator(begin());
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+typename UnrolledList<T, N, Alloc>::template BasicIterator<IsConst>
+UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator+(size_t shift) const {
+    BasicIterator curr_it = *this;
+    while (shift > 0) {
+        if (curr_it.node == nullptr) {
+            throw std::out_of_range("Iterating+ out of range");
+        }
+        size_t left = curr_it.node->count - curr_it.index;
+        if (shift < left) {
+            curr_it.index += shift;
+            break;
+        }
+        shift -= left;
+        curr_it.node = curr_it.node->nextP;
+        curr_it.index = 0;
+    }
+    return curr_it;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+typename UnrolledList<T, N, Alloc>::template BasicIterator<IsConst>
+UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator-(size_t shift) const {
+    BasicIterator curr_it = *this;
+    while (shift > 0) {
+        if (curr_it.node == nullptr) {
+            if (owner == nullptr || owner->tail == nullptr) {
+                throw std::out_of_range("Iterating- out of range");
+            }
+            curr_it.node = owner->tail;
+            curr_it.index = curr_it.node->count;
+        }
+        if (shift <= curr_it.index) {
+            curr_it.index -= shift;
+            break;
+        }
+        shift -= curr_it.index + 1;
+        if (curr_it.node->prevP == nullptr) {
+            throw std::out_of_range("Iterating- out of range");
+        }
+        curr_it.node = curr_it.node->prevP;
+        curr_it.index = curr_it.node->count - 1;
+    }
+    return curr_it;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+typename UnrolledList<T, N, Alloc>::template BasicIterator<IsConst>&
+UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator++() {
+    if (++index == node->count) {
+        node = node->nextP;
+        index = 0;
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+typename UnrolledList<T, N, Alloc>::template BasicIterator<IsConst>
+UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator++(int) {
+    BasicIterator new_it = *this;
+    ++(*this);
+    return new_it;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+typename UnrolledList<T, N, Alloc>::template BasicIterator<IsConst>&
+UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator--() {
+    if (node == nullptr) {
+        node = owner->tail;
+        index = node->count - 1;
+    }
+    else if (index == 0) {
+        node = node->prevP;
+        index = node != nullptr ? node->count - 1 : 0;
+    }
+    else {
+        --index;
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+typename UnrolledList<T, N, Alloc>::template BasicIterator<IsConst>
+UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator--(int) {
+    BasicIterator new_it = *this;
+    --(*this);
+    return new_it;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+template <bool OtherConst>
+bool UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator==(const BasicIterator<OtherConst>& other) const {
+    return node == other.node && index == other.index;
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+template <bool OtherConst>
+bool UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator!=(const BasicIterator<OtherConst>& other) const {
+    return !(*this == other);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+typename UnrolledList<T, N, Alloc>::template BasicIterator<IsConst>::reference
+UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator*() const {
+    return *node->item(index);
+}
+
+template <typename T, size_t N, typename Alloc>
+template <bool IsConst>
+typename UnrolledList<T, N, Alloc>::template BasicIterator<IsConst>::pointer
+UnrolledList<T, N, Alloc>::BasicIterator<IsConst>::operator->() const {
+    return node->item(index);
+}